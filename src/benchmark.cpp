@@ -0,0 +1,458 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file benchmark.cpp
+ * @brief Defines the built-in benchmark of the HDCP key derivation paths.
+ * @details
+ *
+ * Every case derives keys for a fixed stream of KSVs until at least `min_duration` has passed
+ * and reports the throughput in keysets per second.
+ *
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "benchmark.h"
+
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "hdcp.h"
+#include "hex-encode.h"
+#include "intel-hdcp-key.h"
+#include "keyset-batch.h"
+#include "keyset-kernel.h"
+#include "keyset-sweep.h"
+#include "ksv.h"
+#include "ksv-generator.h"
+#include "ksv-parse.h"
+#include "ksv-set.h"
+#include "ksv-validate.h"
+#include "nibble-table.h"
+
+namespace
+{
+    /**
+     * @brief Minimal time that every benchmark case runs for.
+    */
+    constexpr std::chrono::milliseconds min_duration(250);
+
+    /**
+     * @brief Number of KSVs in every benchmark stream.
+    */
+    constexpr std::size_t stream_size = 4096;
+
+    /**
+     * @brief Number of KSVs in one `generate_batch()` call.
+    */
+    constexpr std::size_t batch_size = 256;
+
+    /**
+     * @brief Consumes benchmark results so the compiler cannot drop the measured work.
+    */
+    volatile std::uint64_t benchmark_sink = 0;
+
+    /**
+     * @brief Generates a stream of random valid KSVs.
+     * @param[in] n The number of KSVs.
+     * @return The KSV stream.
+    */
+    std::vector<std::bitset<40>> random_stream(std::size_t n)
+    {
+        std::vector<std::bitset<40>> result(n);
+
+        for(auto &x : result)
+            x = random_ksv();
+
+        return result;
+    }
+
+    /**
+     * @brief Measures and prints the throughput of one benchmark case.
+     *
+     * @tparam F Callable type `std::uint64_t(std::uint64_t &acc)`.
+     * @param[in] name The benchmark case name.
+     * @param[in] round Runs one round of the case, folds its results into `acc` and returns the number of produced items.
+     * @param[in] unit The name of the produced items.
+    */
+    template<typename F>
+    void measure_rounds(std::string const &name, F round, char const *unit = "keysets")
+    {
+        using clock = std::chrono::steady_clock;
+
+        std::uint64_t keysets = 0;
+        std::uint64_t acc     = 0;
+        auto const start      = clock::now();
+        auto elapsed          = clock::duration::zero();
+
+        while(elapsed < min_duration)
+        {
+            keysets += round(acc);
+            elapsed = clock::now() - start;
+        }
+
+        benchmark_sink = acc;
+
+        double const seconds = std::chrono::duration<double>(elapsed).count();
+
+        std::cout << std::left << std::setw(56) << name << std::right << std::setw(16) << std::fixed << std::setprecision(0) << keysets / seconds
+                  << ' ' << unit << "/s" << std::endl;
+    }
+
+    /**
+     * @brief Measures and prints the throughput of one benchmark case that derives keysets for a KSV stream.
+     *
+     * @tparam F Callable type `std::uint64_t(std::bitset<40> const &)`.
+     * @param[in] name The benchmark case name.
+     * @param[in] ksvs The KSV stream.
+     * @param[in] derive Derives one keyset and returns a value that depends on it.
+    */
+    template<typename F>
+    void measure(std::string const &name, std::vector<std::bitset<40>> const &ksvs, F derive)
+    {
+        measure_rounds(name,
+                       [&](std::uint64_t &acc)
+                       {
+                           for(auto const &ksv : ksvs)
+                               acc += derive(ksv);
+
+                           return static_cast<std::uint64_t>(ksvs.size());
+                       });
+    }
+} // namespace
+
+void run_benchmark()
+{
+    std::vector<std::bitset<40>> const ksvs = random_stream(stream_size);
+
+    std::cout << "Random KSV stream, " << ksvs.size() << " KSVs:" << std::endl;
+
+    measure("generate_source + generate_sink (bitset)",
+            ksvs,
+            [](std::bitset<40> const &ksv)
+            {
+                return generate_source(ksv, intel_hdcp_key)[0].to_ullong() + generate_sink(ksv, intel_hdcp_key)[39].to_ullong();
+            });
+
+    measure("generate_source + generate_sink (master_matrix)",
+            ksvs,
+            [](std::bitset<40> const &ksv)
+            {
+                return generate_source(ksv, intel_master_matrix)[0].to_ullong() + generate_sink(ksv, intel_master_matrix)[39].to_ullong();
+            });
+
+    for(auto const &kernel : supported_keyset_kernels())
+    {
+        measure(std::string("generate_keyset (") + kernel.name + ")",
+                ksvs,
+                [&kernel](std::bitset<40> const &ksv)
+                {
+                    std::array<std::uint8_t, 40> index;
+                    std::size_t const count = set_bit_indices(ksv, index);
+
+                    hdcp_keyset keys;
+                    kernel.derive(index.data(), count, intel_master_matrix, keys);
+                    return keys.source[0] + keys.sink[39];
+                });
+    }
+
+    measure("nibble_table",
+            ksvs,
+            [](std::bitset<40> const &ksv)
+            {
+                hdcp_keyset const keys = intel_nibble_table.generate_keyset(ksv);
+                return keys.source[0] + keys.sink[39];
+            });
+
+    std::vector<std::bitset<40>> sequential(stream_size);
+    for(std::size_t n = 0; n < sequential.size(); n++)
+        sequential[n] = ksv_unrank(ksv_count / 2 + n);
+
+    std::vector<std::bitset<40>> enumerated(stream_size);
+    revolving_door_sweep door(intel_master_matrix);
+    for(auto &x : enumerated)
+    {
+        x = door.ksv();
+        door.next();
+    }
+
+    std::pair<char const *, std::vector<std::bitset<40>> const *> const streams[] = {
+        {"random", &ksvs},
+        {"sequential ranks", &sequential},
+        {"revolving-door order", &enumerated},
+    };
+
+    for(auto const &stream : streams)
+    {
+        std::cout << std::endl << "Branchy vs branch-free derivation, " << stream.first << " KSV stream:" << std::endl;
+
+        measure("generate_source + generate_sink (master_matrix)",
+                *stream.second,
+                [](std::bitset<40> const &ksv)
+                {
+                    return generate_source(ksv, intel_master_matrix)[0].to_ullong() + generate_sink(ksv, intel_master_matrix)[39].to_ullong();
+                });
+
+        measure("generate_keyset_masked",
+                *stream.second,
+                [](std::bitset<40> const &ksv)
+                {
+                    hdcp_keyset const keys = generate_keyset_masked(ksv, intel_master_matrix);
+                    return keys.source[0] + keys.sink[39];
+                });
+    }
+
+    std::cout << std::endl << "Batch derivation, random KSV stream:" << std::endl;
+
+    std::vector<std::uint64_t> packed(ksvs.size());
+    for(std::size_t n = 0; n < ksvs.size(); n++)
+        packed[n] = ksvs[n].to_ullong();
+
+    keyset_batch batch(batch_size);
+    measure_rounds("generate_batch (" + std::to_string(batch_size) + " KSVs per batch)",
+                   [&](std::uint64_t &acc)
+                   {
+                       for(std::size_t first = 0; first < packed.size(); first += batch_size)
+                       {
+                           generate_batch(packed.data() + first, batch_size, intel_nibble_table, batch);
+                           acc += batch.source(0)[0] + batch.sink(39)[batch_size - 1];
+                       }
+
+                       return static_cast<std::uint64_t>(packed.size());
+                   });
+
+    {
+        keyset_batch batch(256);
+        keyset_batch complement(256);
+
+        measure_rounds("generate_batch_complement (256 KSVs + 256 complements)",
+                       [&](std::uint64_t &acc)
+                       {
+                           for(std::size_t first = 0; first < packed.size(); first += 256)
+                           {
+                               generate_batch_complement(packed.data() + first, 256, intel_nibble_table, batch, complement);
+                               acc += batch.source(0)[0] + complement.sink(39)[255];
+                           }
+
+                           return static_cast<std::uint64_t>(2 * packed.size());
+                       });
+    }
+
+    std::cout << std::endl << "Revolving-door sweep:" << std::endl;
+
+    revolving_door_sweep sweep(intel_master_matrix);
+    measure_rounds("revolving_door_sweep",
+                   [&sweep](std::uint64_t &acc)
+                   {
+                       hdcp_keyset keys;
+
+                       for(std::size_t n = 0; n < stream_size; n++)
+                       {
+                           sweep.next();
+                           sweep.keyset(keys);
+                           acc += keys.source[0] + keys.sink[39];
+                       }
+
+                       return static_cast<std::uint64_t>(stream_size);
+                   });
+
+    std::cout << std::endl << "Random KSV generation:" << std::endl;
+
+    measure_rounds(
+        "random_ksv",
+        [](std::uint64_t &acc)
+        {
+            for(std::size_t n = 0; n < stream_size; n++)
+                acc += random_ksv().to_ullong();
+
+            return static_cast<std::uint64_t>(stream_size);
+        },
+        "KSVs");
+
+    measure_rounds(
+        "ksv_generator",
+        [](std::uint64_t &acc)
+        {
+            ksv_generator &generator = ksv_generator::local();
+
+            for(std::size_t n = 0; n < stream_size; n++)
+                acc += generator();
+
+            return static_cast<std::uint64_t>(stream_size);
+        },
+        "KSVs");
+
+    measure_rounds(
+        "seeded_ksv_generator",
+        [](std::uint64_t &acc)
+        {
+            static std::uint64_t index = 0;
+            seeded_ksv_generator const generator(1);
+
+            for(std::size_t n = 0; n < stream_size; n++)
+                acc += generator(index++);
+
+            return static_cast<std::uint64_t>(stream_size);
+        },
+        "KSVs");
+
+    measure_rounds(
+        "ksv_permutation",
+        [](std::uint64_t &acc)
+        {
+            static std::uint64_t index = 0;
+            ksv_permutation const permutation(1);
+
+            for(std::size_t n = 0; n < stream_size; n++)
+                acc += permutation(index++);
+
+            return static_cast<std::uint64_t>(stream_size);
+        },
+        "KSVs");
+
+    std::cout << std::endl << "Exclusion list lookups, random KSV stream:" << std::endl;
+
+    for(std::size_t size = 1000; size <= 10000000; size *= 100)
+    {
+        std::vector<std::uint64_t> listed(size);
+        for(auto &x : listed)
+            x = ksv_generator::local()();
+
+        ksv_set const excluded(std::move(listed));
+
+        measure_rounds(
+            "ksv_set::contains (" + std::to_string(size) + " KSVs)",
+            [&](std::uint64_t &acc)
+            {
+                for(std::uint64_t const ksv : packed)
+                    acc += excluded.contains(ksv);
+
+                return static_cast<std::uint64_t>(packed.size());
+            },
+            "lookups");
+    }
+
+    std::cout << std::endl << "KSV parsing:" << std::endl;
+
+    std::vector<std::string> texts(stream_size);
+    for(std::size_t n = 0; n < texts.size(); n++)
+        texts[n] = bitset_to_hex<40>(ksvs[n]);
+
+    std::vector<std::string_view> const views(texts.begin(), texts.end());
+    std::vector<std::uint64_t> parsed(views.size());
+
+    measure_rounds(
+        "parse_ksvs",
+        [&](std::uint64_t &acc)
+        {
+            hex_parse_result error;
+            acc += parse_ksvs(views.data(), views.size(), parsed.data(), error) + parsed.back();
+
+            return static_cast<std::uint64_t>(views.size());
+        },
+        "KSVs");
+
+    std::vector<std::uint64_t> values(ksvs.size());
+    for(std::size_t n = 0; n < values.size(); n++)
+        values[n] = ksvs[n].to_ullong();
+
+    std::vector<std::uint8_t> valid(values.size());
+
+    measure_rounds(
+        "check_ksv_weights",
+        [&](std::uint64_t &acc)
+        {
+            check_ksv_weights(values.data(), values.size(), valid.data());
+            acc += valid.back();
+
+            return static_cast<std::uint64_t>(values.size());
+        },
+        "KSVs");
+
+    std::cout << std::endl << "Hex encoding (the " << intel_master_matrix.row_major().size() << " Master Key Matrix keys):" << std::endl;
+
+    std::vector<std::uint64_t> const keys(intel_master_matrix.row_major().begin(), intel_master_matrix.row_major().end());
+    std::vector<char> digits(keys.size() * key_hex_digits);
+
+    measure_rounds(
+        "hex_digits (per nibble)",
+        [&](std::uint64_t &acc)
+        {
+            for(std::size_t n = 0; n < keys.size(); n++)
+            {
+                std::array<char, key_hex_digits> const d = hex_digits<56>(keys[n]);
+                std::memcpy(digits.data() + n * key_hex_digits, d.data(), d.size());
+            }
+
+            acc += static_cast<std::uint64_t>(digits.back());
+            return static_cast<std::uint64_t>(keys.size());
+        },
+        "keys");
+
+    for(auto const &encoder : supported_hex_encoders())
+    {
+        measure_rounds(
+            std::string("encode (") + encoder.name + ", 40 keys per call)",
+            [&](std::uint64_t &acc)
+            {
+                for(std::size_t n = 0; n < keys.size(); n += 40)
+                    encoder.encode(keys.data() + n, 40, digits.data() + n * key_hex_digits);
+
+                acc += static_cast<std::uint64_t>(digits.back());
+                return static_cast<std::uint64_t>(keys.size());
+            },
+            "keys");
+    }
+
+    std::cout << std::endl << "Keyset formatting:" << std::endl;
+
+    output_buffer text;
+
+    hdcp const h(intel_master_matrix, ksvs[0]);
+
+    for(std::string const name : {"text_informational", "text_line_source", "json", "jsonl", "yaml", "xml", "toml"})
+    {
+        formatted_out_type const t = string_to_fot(name);
+
+        measure_rounds(
+            "hdcp::format (" + name + ")",
+            [&](std::uint64_t &acc)
+            {
+                for(std::size_t n = 0; n < 1000; n++)
+                {
+                    text.clear();
+                    h.format(t, text);
+                }
+
+                acc += text.size();
+                return static_cast<std::uint64_t>(1000);
+            });
+    }
+}
@@ -0,0 +1,571 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file bulk.cpp
+ * @brief Defines the bulk generation modes that produce many keysets in one process.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "bulk.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "keyset-sweep.h"
+#include "keyset-format.h"
+#include "ksv.h"
+#include "ksv-binary.h"
+#include "ksv-generator.h"
+#include "ksv-parse.h"
+#include "ksv-validate.h"
+#include "mapped-file.h"
+#include "output-buffer.h"
+#include "parallel.h"
+
+namespace
+{
+    /**
+     * @brief Number of keysets in one block of work.
+    */
+    constexpr std::uint64_t keysets_per_block = 1024;
+
+    /**
+     * @brief Appends one formatted keyset, followed by a new line if it does not end with one, to a block.
+     * @param[in] formatter The formatter of the output format.
+     * @param[in] ksv Key Selection Vector (KSV).
+     * @param[in] keys The source and sink HDCP keys of `ksv`.
+     * @param[in] key The packed Master Key Matrix.
+     * @param[out] out The block.
+    */
+    void append_keyset(keyset_formatter const &formatter, std::bitset<40> const &ksv, hdcp_keyset const &keys, master_matrix const &key, output_buffer &out)
+    {
+        char *const record = out.extend(formatter.record_size);
+
+        formatter.write(ksv.to_ullong(), keys, key, record);
+        record[formatter.record_size - 1] = '\n';
+    }
+
+    /**
+     * @brief Generates the keysets of the KSVs of consecutive indices and writes them in index order.
+     *
+     * @tparam F Callable type `std::uint64_t(std::uint64_t i)`, safe to call from several threads.
+     * @param[in] table The nibble table of the Master Key Matrix.
+     * @param[in] indices Number of indices.
+     * @param[in] count The maximal number of keysets to write.
+     * @param[in] threads Number of worker threads.
+     * @param[in] t Output format.
+     * @param[out] os Output stream.
+     * @param[in] ksv_of Returns the KSV of the index `i`, or 0 to skip the index.
+    */
+    template<typename F>
+    void write_keysets(nibble_table const &table, std::uint64_t indices, std::uint64_t count, unsigned threads, formatted_out_type t, std::ostream &os, F ksv_of)
+    {
+        keyset_formatter const &formatter = keyset_formatter_of(t);
+        std::uint64_t const blocks        = (indices + keysets_per_block - 1) / keysets_per_block;
+        std::uint64_t written             = 0;
+
+        run_ordered<output_buffer>(
+            blocks,
+            threads,
+            [&](std::uint64_t b, output_buffer &out)
+            {
+                std::uint64_t const first = b * keysets_per_block;
+                std::uint64_t const n     = std::min(keysets_per_block, indices - first);
+
+                out.clear();
+                out.reserve(n * formatter.record_size);
+
+                for(std::uint64_t i = 0; i < n; i++)
+                {
+                    std::bitset<40> const ksv = ksv_of(first + i);
+                    if(ksv.none())
+                        continue;
+
+                    append_keyset(formatter, ksv, table.generate_keyset(ksv), table.matrix(), out);
+                }
+            },
+            [&](output_buffer &out)
+            {
+                // Every record has the same size
+                std::uint64_t const records = std::min<std::uint64_t>(out.size() / formatter.record_size, count - written);
+
+                out.write_to(os, records * formatter.record_size);
+
+                written += records;
+                return written < count && static_cast<bool>(os);
+            });
+    }
+
+    /**
+     * @brief Target size of one block of a KSV list in bytes; blocks end at a new line.
+    */
+    constexpr std::size_t list_bytes_per_block = 64 * 1024;
+
+    /**
+     * @brief Size of one read from the standard input.
+    */
+    constexpr std::size_t stdin_read_size = 4 * 1024 * 1024;
+
+    /**
+     * @brief Returns the error message of a listed KSV that is excluded.
+     * @param[in] ksv Key Selection Vector (KSV).
+    */
+    std::string excluded_ksv_message(std::uint64_t ksv)
+    {
+        return "'" + bitset_to_hex<40>(ksv) + "' is excluded (see '--exclude').";
+    }
+
+    /**
+     * @brief A block of formatted keysets of a KSV list.
+    */
+    struct list_block
+    {
+        /**
+         * @brief The formatted keysets.
+        */
+        output_buffer text;
+
+        /**
+         * @brief Number of lines (text) or records (binary) in the block, up to the error, if any.
+        */
+        std::uint64_t lines;
+
+        /**
+         * @brief The error of the last line, empty if every line is valid.
+        */
+        std::string error;
+    };
+
+    /**
+     * @brief Generates the keysets of the KSVs listed in complete lines and writes them in line order.
+     *
+     * @param[in] table The nibble table of the Master Key Matrix.
+     * @param[in] data The lines.
+     * @param[in] size The size of `data` in bytes.
+     * @param[in] name The list name, used in error messages.
+     * @param[in,out] line_number Number of lines before `data`; advanced past the processed lines.
+     * @param[in] excluded KSVs that must not be listed.
+     * @param[in] threads Number of worker threads.
+     * @param[in] t Output format.
+     * @param[out] os Output stream.
+     * @param[out] error Receives the error message of the first line that is not a valid KSV or is excluded.
+     * @return True if every line is valid.
+    */
+    bool write_listed_keysets(nibble_table const &table,
+                              char const *data,
+                              std::size_t size,
+                              std::string const &name,
+                              std::uint64_t &line_number,
+                              ksv_set const &excluded,
+                              unsigned threads,
+                              formatted_out_type t,
+                              std::ostream &os,
+                              std::string &error)
+    {
+        keyset_formatter const &formatter = keyset_formatter_of(t);
+
+        // Blocks end at a new line, so the worker threads never share a line
+        std::vector<std::size_t> const bounds = line_blocks(data, size, list_bytes_per_block);
+
+        bool valid = true;
+
+        run_ordered<list_block>(
+            bounds.size() - 1,
+            threads,
+            [&](std::uint64_t b, list_block &out)
+            {
+                char const *p         = data + bounds[b];
+                char const *const end = data + bounds[b + 1];
+
+                out.text.clear();
+                out.lines = 0;
+                out.error.clear();
+
+                while(p < end)
+                {
+                    void const *const newline = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+                    char const *const eol     = newline ? static_cast<char const *>(newline) : end;
+
+                    std::string_view const text = ksv_line_text(std::string_view(p, static_cast<std::size_t>(eol - p)));
+
+                    out.lines++;
+                    p = eol + 1;
+
+                    if(text.empty())
+                        continue;
+
+                    hex_parse_result const parsed = parse_ksv(text);
+
+                    if(!parsed)
+                    {
+                        out.error = ksv_parse_error_message(text, parsed);
+                        break;
+                    }
+
+                    std::bitset<40> const ksv = parsed.value;
+
+                    if(!check_ksv(ksv))
+                    {
+                        out.error = ksv_weight_error_message(parsed.value);
+                        break;
+                    }
+
+                    if(excluded.contains(parsed.value))
+                    {
+                        out.error = excluded_ksv_message(parsed.value);
+                        break;
+                    }
+
+                    append_keyset(formatter, ksv, table.generate_keyset(ksv), table.matrix(), out.text);
+                }
+            },
+            [&](list_block &out)
+            {
+                out.text.write_to(os);
+                line_number += out.lines;
+
+                if(!out.error.empty())
+                {
+                    error = name + ":" + std::to_string(line_number) + ": " + out.error;
+                    valid = false;
+                }
+
+                return valid && static_cast<bool>(os);
+            });
+
+        return valid;
+    }
+
+    /**
+     * @brief Number of KSVs in one block of a binary KSV list.
+    */
+    constexpr std::size_t records_per_block = 4096;
+
+    /**
+     * @brief Generates the keysets of the KSVs of a binary KSV list and writes them in list order.
+     *
+     * @param[in] table The nibble table of the Master Key Matrix.
+     * @param[in] records The 5-byte KSV records.
+     * @param[in] count Number of records.
+     * @param[in] name The list name, used in error messages.
+     * @param[in,out] record_number Number of records before `records`; advanced past the processed records.
+     * @param[in] excluded KSVs that must not be listed.
+     * @param[in] threads Number of worker threads.
+     * @param[in] t Output format.
+     * @param[out] os Output stream.
+     * @param[out] error Receives the error message of the first record that is not a valid KSV or is excluded.
+     * @return True if every record is valid.
+    */
+    bool write_binary_keysets(nibble_table const &table,
+                              char const *records,
+                              std::uint64_t count,
+                              std::string const &name,
+                              std::uint64_t &record_number,
+                              ksv_set const &excluded,
+                              unsigned threads,
+                              formatted_out_type t,
+                              std::ostream &os,
+                              std::string &error)
+    {
+        keyset_formatter const &formatter = keyset_formatter_of(t);
+
+        bool valid = true;
+
+        run_ordered<list_block>(
+            (count + records_per_block - 1) / records_per_block,
+            threads,
+            [&](std::uint64_t b, list_block &out)
+            {
+                std::uint64_t const first = b * records_per_block;
+                std::uint64_t const n     = std::min<std::uint64_t>(records_per_block, count - first);
+
+                out.text.clear();
+                out.text.reserve(n * formatter.record_size);
+                out.lines = 0;
+                out.error.clear();
+
+                for(std::uint64_t i = 0; i < n; i++)
+                {
+                    std::uint64_t const value = load_ksv_record(records + (first + i) * ksv_binary_record_size);
+                    std::bitset<40> const ksv = value;
+
+                    out.lines++;
+
+                    if(!check_ksv(ksv))
+                    {
+                        out.error = ksv_weight_error_message(value);
+                        break;
+                    }
+
+                    if(excluded.contains(value))
+                    {
+                        out.error = excluded_ksv_message(value);
+                        break;
+                    }
+
+                    append_keyset(formatter, ksv, table.generate_keyset(ksv), table.matrix(), out.text);
+                }
+            },
+            [&](list_block &out)
+            {
+                out.text.write_to(os);
+                record_number += out.lines;
+
+                if(!out.error.empty())
+                {
+                    error = name + ":" + std::to_string(record_number) + ": " + out.error;
+                    valid = false;
+                }
+
+                return valid && static_cast<bool>(os);
+            });
+
+        return valid;
+    }
+} // namespace
+
+void enumerate_keysets(master_matrix const &key, std::uint64_t from, std::uint64_t count, bool complement, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os)
+{
+    keyset_formatter const &formatter = keyset_formatter_of(t);
+    std::uint64_t const blocks        = (count + keysets_per_block - 1) / keysets_per_block;
+
+    run_ordered<output_buffer>(
+        blocks,
+        threads,
+        [&](std::uint64_t b, output_buffer &out)
+        {
+            std::uint64_t const first = from + b * keysets_per_block;
+            std::uint64_t const n     = std::min(keysets_per_block, from + count - first);
+
+            std::bitset<40> ksv = ksv_unrank(first);
+            incremental_keyset keys(key, ksv);
+            hdcp_keyset keyset;
+
+            out.clear();
+            out.reserve(n * formatter.record_size * (complement ? 2 : 1));
+
+            for(std::uint64_t i = 0; i < n; i++)
+            {
+                if(i != 0)
+                {
+                    ksv = ksv_next(ksv);
+                    keys.move_to(ksv);
+                }
+
+                keys.keyset(keyset);
+
+                if(!excluded.contains(ksv.to_ullong()))
+                {
+                    append_keyset(formatter, ksv, keyset, key, out);
+                }
+
+                if(complement && !excluded.contains((~ksv).to_ullong()))
+                {
+                    append_keyset(formatter, ~ksv, complement_keyset(keyset, key), key, out);
+                }
+            }
+        },
+        [&](output_buffer &out)
+        {
+            out.write_to(os);
+            return static_cast<bool>(os);
+        });
+}
+
+void random_keysets(nibble_table const &table, std::uint64_t count, std::optional<std::uint64_t> seed, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os)
+{
+    if(seed)
+    {
+        seeded_ksv_generator const generator(*seed);
+
+        write_keysets(table,
+                      count,
+                      count,
+                      threads,
+                      t,
+                      os,
+                      [&](std::uint64_t i)
+                      {
+                          std::uint64_t ksv = generator(i);
+
+                          for(std::uint32_t draw = 1; excluded.contains(ksv); draw++)
+                              ksv = generator(i, draw);
+
+                          return ksv;
+                      });
+    }
+    else
+    {
+        write_keysets(table,
+                      count,
+                      count,
+                      threads,
+                      t,
+                      os,
+                      [&](std::uint64_t)
+                      {
+                          ksv_generator &generator = ksv_generator::local();
+                          std::uint64_t ksv        = generator();
+
+                          while(excluded.contains(ksv))
+                              ksv = generator();
+
+                          return ksv;
+                      });
+    }
+}
+
+void unique_keysets(nibble_table const &table, std::uint64_t from, std::uint64_t count, std::uint64_t seed, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os)
+{
+    ksv_permutation const permutation(seed);
+
+    // Excluded KSVs are skipped, so the indices after the range may be needed
+    std::uint64_t const indices = excluded.empty() ? count : ksv_count - from;
+
+    write_keysets(table,
+                  indices,
+                  count,
+                  threads,
+                  t,
+                  os,
+                  [&](std::uint64_t i)
+                  {
+                      std::uint64_t const ksv = permutation(from + i);
+                      return excluded.contains(ksv) ? 0 : ksv;
+                  });
+}
+
+bool listed_keysets(nibble_table const &table, std::string const &path, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os, std::string &error)
+{
+    std::uint64_t line_number = 0;
+
+    if(path != "-")
+    {
+        mapped_file file;
+
+        if(!file.open(path, error))
+            return false;
+
+        if(is_ksv_binary(file.data(), file.size()))
+        {
+            std::uint64_t count = 0;
+
+            if(!check_ksv_binary(file.data(), file.size(), path, count, error))
+                return false;
+
+            return write_binary_keysets(table, file.data() + ksv_binary_header_size, count, path, line_number, excluded, threads, t, os, error);
+        }
+
+        return write_listed_keysets(table, file.data(), file.size(), path, line_number, excluded, threads, t, os, error);
+    }
+
+    // The standard input is read in large blocks; every block is processed up to its last new line (text)
+    // or its last complete record (binary)
+    std::vector<char> buffer(stdin_read_size);
+    std::size_t filled = 0;
+    bool eof           = false;
+    bool first         = true;
+    bool binary        = false;
+    std::uint64_t left = 0; // Binary: records that are not read yet
+
+    while(!eof)
+    {
+        // A line that does not fit: grow the buffer
+        if(filled == buffer.size())
+            buffer.resize(buffer.size() * 2);
+
+        filled += std::fread(buffer.data() + filled, 1, buffer.size() - filled, stdin);
+        eof = filled < buffer.size();
+
+        if(eof && std::ferror(stdin))
+        {
+            error = "Cannot read the standard input.";
+            return false;
+        }
+
+        if(first)
+        {
+            first  = false;
+            binary = is_ksv_binary(buffer.data(), filled);
+
+            if(binary)
+            {
+                if(filled < ksv_binary_header_size)
+                {
+                    error = "<stdin>: truncated binary KSV list header.";
+                    return false;
+                }
+
+                left = ksv_binary_count(buffer.data());
+
+                std::memmove(buffer.data(), buffer.data() + ksv_binary_header_size, filled - ksv_binary_header_size);
+                filled -= ksv_binary_header_size;
+            }
+        }
+
+        if(binary)
+        {
+            std::uint64_t const records = std::min<std::uint64_t>(filled / ksv_binary_record_size, left);
+            std::size_t const complete  = static_cast<std::size_t>(records) * ksv_binary_record_size;
+
+            if(eof && (records != left || complete != filled))
+            {
+                error = "<stdin>: the binary KSV list should hold " + std::to_string(left) + " more KSVs, but " + std::to_string(filled) + " bytes are left.";
+                return false;
+            }
+
+            if(!write_binary_keysets(table, buffer.data(), records, "<stdin>", line_number, excluded, threads, t, os, error))
+                return false;
+
+            left -= records;
+
+            std::memmove(buffer.data(), buffer.data() + complete, filled - complete);
+            filled -= complete;
+            continue;
+        }
+
+        std::size_t complete = filled;
+
+        if(!eof)
+        {
+            while(complete != 0 && buffer[complete - 1] != '\n')
+                complete--;
+
+            if(complete == 0)
+                continue;
+        }
+
+        if(!write_listed_keysets(table, buffer.data(), complete, "<stdin>", line_number, excluded, threads, t, os, error))
+            return false;
+
+        std::memmove(buffer.data(), buffer.data() + complete, filled - complete);
+        filled -= complete;
+    }
+
+    return true;
+}
@@ -0,0 +1,138 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file bulk.h
+ * @brief Defines the bulk generation modes that produce many keysets in one process.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef BULK_H
+#define BULK_H
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+
+#include "hdcp.h"
+#include "ksv-set.h"
+#include "nibble-table.h"
+
+/**
+ * @brief Generates the keysets of consecutive KSV ranks and writes them in rank order.
+ * @details
+ *
+ * The rank range is split into blocks that are generated by worker threads.
+ * Inside a block the keys are updated incrementally from one KSV to the next.
+ * Every keyset is formatted as in the single-KSV mode and followed by a new line if it does not end with one.
+ *
+ * With `complement` every KSV is followed by its complement `~ksv`, whose keys are computed from the keys of `ksv`
+ * by one subtraction per value (see complement_keyset()). The complement of rank `r` has rank `ksv_count - 1 - r`,
+ * so the ranks `[0, ksv_count / 2)` with their complements cover every valid KSV exactly once.
+ *
+ * @param[in] key The packed Master Key Matrix.
+ * @param[in] from The first rank.
+ * @param[in] count Number of ranks.
+ * @param[in] complement Also write the keyset of the complement of every KSV.
+ * @param[in] excluded KSVs that are skipped.
+ * @param[in] threads Number of worker threads.
+ * @param[in] t Output format.
+ * @param[out] os Output stream.
+ * @pre `from + count` is less or equal `ksv_count`.
+ * @see ksv_rank()
+*/
+void enumerate_keysets(master_matrix const &key, std::uint64_t from, std::uint64_t count, bool complement, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os);
+
+/**
+ * @brief Generates the keysets of random valid KSVs.
+ * @details
+ *
+ * The KSVs are uniformly distributed and drawn independently (see ksv_generator), so they may repeat.
+ * The keysets are generated in blocks by worker threads and written as soon as they are ready,
+ * formatted as in the single-KSV mode and followed by a new line if they do not end with one.
+ *
+ * With a seed the KSV `i` is a function of the seed and `i` only (see seeded_ksv_generator),
+ * so the output is reproducible and does not depend on the number of threads.
+ *
+ * @param[in] table The nibble table of the Master Key Matrix; every keyset is derived from it.
+ * @param[in] count Number of keysets.
+ * @param[in] seed The seed, or none for a seed from `std::random_device`.
+ * @param[in] excluded KSVs that are never generated. An excluded KSV is replaced by another draw
+ *                     (with a seed: the next draw of the same index).
+ * @param[in] threads Number of worker threads.
+ * @param[in] t Output format.
+ * @param[out] os Output stream.
+*/
+void random_keysets(nibble_table const &table, std::uint64_t count, std::optional<std::uint64_t> seed, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os);
+
+/**
+ * @brief Generates the keysets of distinct random valid KSVs.
+ * @details
+ *
+ * The KSV `i` is the image of the index `from + i` under the keyed permutation of the seed (see ksv_permutation),
+ * so no KSV appears twice, nothing is stored and the output does not depend on the number of threads.
+ * Runs with the same seed and disjoint index ranges never share a KSV.
+ *
+ * Excluded KSVs are skipped and the following indices are used instead, until `count` keysets are written
+ * or the indices run out.
+ *
+ * @param[in] table The nibble table of the Master Key Matrix; every keyset is derived from it.
+ * @param[in] from The first index.
+ * @param[in] count Number of keysets.
+ * @param[in] seed The seed.
+ * @param[in] excluded KSVs that are skipped.
+ * @param[in] threads Number of worker threads.
+ * @param[in] t Output format.
+ * @param[out] os Output stream.
+ * @pre `from + count` is less or equal `ksv_count`.
+*/
+void unique_keysets(nibble_table const &table, std::uint64_t from, std::uint64_t count, std::uint64_t seed, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os);
+
+/**
+ * @brief Generates the keysets of the KSVs listed in a file or in the standard input.
+ * @details
+ *
+ * The list has one KSV per line (see ksv_line_text() and parse_ksv()), or is a binary KSV list (see ksv-binary.h),
+ * detected by its magic bytes. A regular file is memory-mapped; the standard input (`-`) is read in large blocks.
+ * The records of a binary list are read in place, without copying or decoding. The input is split into blocks that end at a new line
+ * and are generated by worker threads; the keysets are written in the order of the lines.
+ * Every keyset is formatted as in the single-KSV mode and followed by a new line if it does not end with one.
+ *
+ * The first line that is not a valid KSV (not hexadecimal, or without exactly twenty '1's, see check_ksv())
+ * stops the generation: the keysets of the lines before it are written and the error names its line number
+ * (the record number in a binary list). A listed KSV that is excluded stops the generation the same way,
+ * so the keysets always correspond 1:1 to the listed KSVs.
+ *
+ * @param[in] table The nibble table of the Master Key Matrix; every keyset is derived from it.
+ * @param[in] path The file path, or `-` for the standard input.
+ * @param[in] excluded KSVs that must not be listed.
+ * @param[in] threads Number of worker threads.
+ * @param[in] t Output format.
+ * @param[out] os Output stream.
+ * @param[out] error Receives the error message on failure.
+ * @return True on success, false if the input cannot be read or a line is not a valid KSV or is excluded.
+*/
+bool listed_keysets(nibble_table const &table, std::string const &path, ksv_set const &excluded, unsigned threads, formatted_out_type t, std::ostream &os, std::string &error);
+
+#endif // BULK_H
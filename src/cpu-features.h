@@ -0,0 +1,83 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file cpu-features.h
+ * @brief Defines the runtime CPU feature checks used to select vectorized code paths.
+ * @details
+ *
+ * `HGK_X86_SIMD` is defined when the compiler can build x86 vector code with function-level target attributes.
+ * Such code must only run after the matching `cpu_has_*()` check succeeds.
+ *
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#if defined(__x86_64__) || defined(__i386__)
+    #if defined(__GNUC__) || defined(__clang__)
+        #define HGK_X86_SIMD
+    #endif
+#endif
+
+/**
+ * @brief Checks if the running CPU supports SSSE3.
+*/
+inline bool cpu_has_ssse3()
+{
+#ifdef HGK_X86_SIMD
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Checks if the running CPU supports AVX2.
+*/
+inline bool cpu_has_avx2()
+{
+#ifdef HGK_X86_SIMD
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Checks if the running CPU supports AVX-512 (foundation instructions).
+*/
+inline bool cpu_has_avx512()
+{
+#ifdef HGK_X86_SIMD
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f");
+#else
+    return false;
+#endif
+}
+
+#endif // CPU_FEATURES_H
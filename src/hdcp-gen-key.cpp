@@ -37,10 +37,25 @@
 */
 #include "hdcp-gen-key.h"
 
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
+#include <optional>
+#include <utility>
+#include <vector>
 
+#include "benchmark.h"
+#include "bulk.h"
 #include "hdcp.h"
 #include "intel-hdcp-key.h"
+#include "ksv.h"
+#include "ksv-binary.h"
+#include "ksv-generator.h"
+#include "ksv-parse.h"
+#include "ksv-set.h"
+#include "ksv-validate.h"
+#include "nibble-table.h"
+#include "parallel.h"
 #include "xgetopt/xgetopt.h"
 #include "config.h"
 
@@ -49,15 +64,43 @@ int main(int argc, char **argv)
     std::bitset<40> ksv    = random_ksv();
     formatted_out_type out = formatted_out_type::TEXT_INFORMATIONAL;
 
+    bool ksv_given      = false;
+    bool out_given      = false;
+    bool enumerate      = false;
+    bool complement     = false;
+    bool unique         = false;
+    bool count_set      = false;
+    std::uint64_t from  = 0;
+    std::uint64_t count = 0;
+    unsigned threads    = default_thread_count();
+
+    std::optional<std::uint64_t> seed;
+    std::optional<std::string> ksv_file;
+    std::optional<std::string> to_binary;
+    std::optional<std::string> validate;
+    ksv_set excluded;
+
     std::string const short_opts = "k:o:hv";
 
     // clang-format off
-    std::array<xoption, 8> long_options =
+    std::array<xoption, 18> long_options =
         {{
-            {"ksv",     xrequired_argument, nullptr, 'k'},
-            {"out",     xrequired_argument, nullptr, 'o'},
-            {"help",    xno_argument,       nullptr, 'h'},
-            {"version", xno_argument,       nullptr, 'v'}
+            {"ksv",        xrequired_argument, nullptr, 'k'},
+            {"out",        xrequired_argument, nullptr, 'o'},
+            {"help",       xno_argument,       nullptr, 'h'},
+            {"version",    xno_argument,       nullptr, 'v'},
+            {"benchmark",  xno_argument,       nullptr, OPT_BENCHMARK},
+            {"enumerate",  xno_argument,       nullptr, OPT_ENUMERATE},
+            {"from",       xrequired_argument, nullptr, OPT_FROM},
+            {"count",      xrequired_argument, nullptr, OPT_COUNT},
+            {"threads",    xrequired_argument, nullptr, OPT_THREADS},
+            {"complement", xno_argument,       nullptr, OPT_COMPLEMENT},
+            {"seed",       xrequired_argument, nullptr, OPT_SEED},
+            {"unique",     xno_argument,       nullptr, OPT_UNIQUE},
+            {"exclude",    xrequired_argument, nullptr, OPT_EXCLUDE},
+            {"ksv-file",   xrequired_argument, nullptr, OPT_KSV_FILE},
+            {"to-binary",  xrequired_argument, nullptr, OPT_TO_BINARY},
+            {"validate",   xrequired_argument, nullptr, OPT_VALIDATE}
         }};
     // clang-format on
 
@@ -73,19 +116,29 @@ int main(int argc, char **argv)
         switch(opt)
         {
             case 'k':
-                ksv = ksv_string_to_bitset<40>(xoptarg);
+            {
+                hex_parse_result const parsed = parse_ksv(xoptarg);
+
+                if(!parsed)
+                    usage_error(ksv_parse_error_message(xoptarg, parsed));
+
+                ksv = parsed.value;
+
+                if(!check_ksv(ksv))
+                    usage_error(ksv_weight_error_message(ksv.to_ullong()));
+
+                ksv_given = true;
                 break;
+            }
 
             case 'o':
             {
                 out = string_to_fot(xoptarg);
 
                 if(out == formatted_out_type::NOT_FOUND)
-                {
-                    std::cout << "Output format option: '" << xoptarg << "' is not recognized." << std::endl;
-                    std::cout << "Try: 'hdcp-gen-key --help' for more information." << std::endl;
-                    exit(1);
-                }
+                    usage_error(std::string("Output format option: '") + xoptarg + "' is not recognized.");
+
+                out_given = true;
                 break;
             }
             case 'h':
@@ -96,17 +149,233 @@ int main(int argc, char **argv)
                 std::cout << HGK_VERSION << std::endl;
                 exit(0);
                 break;
+            case OPT_BENCHMARK:
+                run_benchmark();
+                exit(0);
+                break;
+            case OPT_ENUMERATE:
+                enumerate = true;
+                break;
+            case OPT_FROM:
+                from = parse_uint64_option("from", xoptarg);
+                break;
+            case OPT_COUNT:
+                count     = parse_uint64_option("count", xoptarg);
+                count_set = true;
+                break;
+            case OPT_COMPLEMENT:
+                complement = true;
+                break;
+            case OPT_KSV_FILE:
+                ksv_file = xoptarg;
+                break;
+            case OPT_TO_BINARY:
+                to_binary = xoptarg;
+                break;
+            case OPT_VALIDATE:
+                validate = xoptarg;
+                break;
+            case OPT_EXCLUDE:
+            {
+                std::vector<std::uint64_t> ksvs;
+                std::string error;
+
+                if(!read_ksv_list(xoptarg, ksvs, error))
+                    fatal_error(error);
+
+                excluded = ksv_set(std::move(ksvs));
+                break;
+            }
+            case OPT_UNIQUE:
+                unique = true;
+                break;
+            case OPT_SEED:
+                seed = parse_uint64_option("seed", xoptarg);
+                break;
+            case OPT_THREADS:
+            {
+                std::uint64_t const t = parse_uint64_option("threads", xoptarg);
+
+                if(t == 0 || t > 1024)
+                    usage_error("The number of threads must be between 1 and 1024.");
+
+                threads = static_cast<unsigned>(t);
+                break;
+            }
             default:
                 exit(1);
         }
     }
 
-    hdcp h(intel_hdcp_key, ksv);
-    std::cout << h.formatted(out);
+    // Batches default to one compact JSON object per line, which can be split and ingested in parallel
+    if(!out_given && (ksv_file || enumerate || count_set || unique))
+        out = formatted_out_type::JSONL;
+
+    if(validate)
+    {
+        if(ksv_given || ksv_file || to_binary || count_set || enumerate || unique || complement || seed || from != 0)
+            usage_error("Option '--validate' can only be used with '--threads'.");
+
+        std::ios::sync_with_stdio(false);
+
+        ksv_validation summary;
+        std::string error;
+
+        if(!validate_ksv_list(*validate, threads, std::cout, summary, error))
+            fatal_error(error);
+
+        // clang-format off
+        std::cout << "Lines:          " << summary.lines         << '\n'
+                  << "KSVs:           " << summary.ksvs          << '\n'
+                  << "Valid:          " << summary.valid         << '\n'
+                  << "Invalid syntax: " << summary.syntax_errors << '\n'
+                  << "Invalid weight: " << summary.weight_errors << std::endl;
+        // clang-format on
+
+        return summary.valid == summary.ksvs ? 0 : 1;
+    }
+
+    if(ksv_file)
+    {
+        if(ksv_given || count_set || enumerate || unique || complement || seed || from != 0)
+            usage_error("Option '--ksv-file' cannot be used with '--ksv', '--count', '--enumerate', '--unique', '--complement', '--seed' or '--from'.");
+
+        std::string error;
+
+        if(to_binary)
+        {
+            if(!convert_ksv_list(*ksv_file, *to_binary, error))
+                fatal_error(error);
+
+            return 0;
+        }
+
+        std::ios::sync_with_stdio(false);
+
+        bool const listed = listed_keysets(intel_nibble_table, *ksv_file, excluded, threads, out, std::cout, error);
+        std::cout.flush();
+
+        if(!listed)
+            fatal_error(error);
+
+        return 0;
+    }
+
+    if(to_binary)
+        usage_error("Option '--to-binary' requires '--ksv-file'.");
+
+    if(enumerate)
+    {
+        if(seed || unique)
+            usage_error("Options '--seed' and '--unique' cannot be used with '--enumerate'.");
+
+        // With '--complement' the ranks of the first half also produce the second half.
+        std::uint64_t const last = complement ? ksv_count / 2 : ksv_count;
+
+        if(from >= last)
+            usage_error("The first rank must be less than " + std::to_string(last) + ".");
+
+        if(!count_set)
+            count = last - from;
+
+        if(count > last - from)
+            usage_error("The rank range must end at or before " + std::to_string(last) + ".");
+
+        std::ios::sync_with_stdio(false);
+        enumerate_keysets(intel_master_matrix, from, count, complement, excluded, threads, out, std::cout);
+        std::cout.flush();
+
+        return 0;
+    }
+
+    if(complement)
+        usage_error("Option '--complement' requires '--enumerate'.");
+
+    if(unique)
+    {
+        if(!count_set)
+            usage_error("Option '--unique' requires '--count'.");
+
+        if(from >= ksv_count || count > ksv_count - from)
+            usage_error("The index range must end at or before " + std::to_string(ksv_count) + ".");
+
+        std::ios::sync_with_stdio(false);
+        unique_keysets(intel_nibble_table, from, count, seed ? *seed : ksv_generator::local().next_u64(), excluded, threads, out, std::cout);
+        std::cout.flush();
+
+        return 0;
+    }
+
+    if(from != 0)
+        usage_error("Option '--from' requires '--enumerate' or '--unique'.");
+
+    if(seed && ksv_given)
+        usage_error("Options '--ksv' and '--seed' cannot be used together.");
+
+    if(count_set)
+    {
+        if(ksv_given)
+            usage_error("Options '--ksv' and '--count' cannot be used together.");
+
+        std::ios::sync_with_stdio(false);
+        random_keysets(intel_nibble_table, count, seed, excluded, threads, out, std::cout);
+        std::cout.flush();
+
+        return 0;
+    }
+
+    if(ksv_given && excluded.contains(ksv.to_ullong()))
+        fatal_error("The KSV " + bitset_to_hex<40>(ksv) + " is excluded.");
+
+    if(seed)
+    {
+        seeded_ksv_generator const generator(*seed);
+        ksv = generator(0);
+
+        for(std::uint32_t draw = 1; excluded.contains(ksv.to_ullong()); draw++)
+            ksv = generator(0, draw);
+    }
+    else if(!ksv_given)
+    {
+        while(excluded.contains(ksv.to_ullong()))
+            ksv = random_ksv();
+    }
+
+    hdcp h(intel_master_matrix, ksv);
+
+    output_buffer text;
+    h.format(out, text);
+    text.write_to(std::cout);
 
     return 0;
 }
 
+void fatal_error(std::string const &message)
+{
+    std::cerr << "hdcp-gen-key: " << message << std::endl;
+    exit(1);
+}
+
+void usage_error(std::string const &message)
+{
+    std::cout << message << std::endl;
+    std::cout << "Try: 'hdcp-gen-key --help' for more information." << std::endl;
+    exit(1);
+}
+
+std::uint64_t parse_uint64_option(std::string const &name, char const *s)
+{
+    char *end = nullptr;
+    errno     = 0;
+
+    unsigned long long const result = std::strtoull(s, &end, 10);
+
+    if(*s < '0' || *s > '9' || *end != '\0' || errno == ERANGE)
+        usage_error("Option '--" + name + "' expects an unsigned decimal number, got: '" + s + "'.");
+
+    return result;
+}
+
 void print_help()
 {
     std::string help =
@@ -116,14 +385,61 @@ It uses Intel's Master Key Matrix.
 usage: hdcp-gen-key [options...]
 
 Options:
-  -k, --ksv <hex>           Key Selection Vector (KSV) in 10-character hexadecimal format.
+  -k, --ksv <hex>           Key Selection Vector (KSV) in 10-character hexadecimal format
+                            (upper or lower case, optionally prefixed with '0x').
                             The KSV must be a 40-bit binary number consisting of
                             twenty '1's and twenty '0's.
                             [default: randomly generated valid KSV]
   -o, --out <format_option> Specifies the output format and content.
                             See 'Output Formats' below.
-                            [default: text_informational]
+                            [default: text_informational, or jsonl with '--count',
+                            '--enumerate' and '--ksv-file']
   --version                 Print the application version and exit.
+  --benchmark               Measure the HDCP key derivation throughput and exit.
+
+Bulk generation:
+  --count <n>               Generate the keysets of n random valid KSVs.
+                            Every keyset is followed by a new line.
+                            With '--enumerate': the number of ranks to enumerate.
+                            [default with '--enumerate': all ranks from '--from' to the last one]
+  --enumerate               Generate the keysets of consecutive valid KSVs in rank order.
+                            The rank of a KSV is its index among all C(40, 20) = 137846528820
+                            valid KSVs in ascending numeric order (rank 0 is 00000fffff).
+                            Every keyset is followed by a new line.
+  --from <rank>             The first rank to enumerate, or with '--unique' the first index.
+                            [default: 0]
+  --complement              Follow every KSV by its complement (every bit inverted), whose keys
+                            are computed from the keys of the KSV for a fraction of the cost.
+                            The ranks are then limited to the first half, 0 to 68923264409,
+                            which together with the complements cover every valid KSV.
+  --unique                  With '--count': every KSV appears at most once. The KSVs are the
+                            indices '--from' to '--from' + n - 1 of a random permutation of all
+                            valid KSVs chosen by the seed, so runs with the same '--seed' and
+                            disjoint index ranges never share a KSV either.
+  --ksv-file <file>         Generate the keysets of the KSVs listed in a file, one hexadecimal KSV
+                            per line (empty lines and lines starting with '#' are ignored),
+                            in the order of the lines. '-' reads the standard input.
+                            Binary KSV lists (see '--to-binary') are detected and read as well.
+                            Every keyset is followed by a new line. The first line that is not
+                            a valid KSV (see '--validate') stops the run with an error.
+  --to-binary <file>        With '--ksv-file': convert the KSV list to a binary KSV list instead
+                            (a 16-byte header, then 5 bytes per KSV, little-endian), which is
+                            read without hexadecimal decoding. '-' writes the standard output.
+  --validate <file>         Check a KSV list (text or binary, '-' reads the standard input) without
+                            generating keysets: every line must be a hexadecimal KSV with exactly
+                            twenty '1's. Invalid lines are reported as '<file>:<line>: <message>',
+                            followed by a summary. Exits with 1 if any KSV is invalid.
+  --exclude <file>          Never generate the KSVs listed in a file (one hexadecimal KSV per line;
+                            empty lines and lines starting with '#' are ignored), e.g. the KSVs
+                            that are already issued or revoked. '--count' draws replacements,
+                            '--unique' and '--enumerate' skip them, and '--ksv-file' stops with
+                            an error at the first listed KSV that is excluded.
+  --seed <n>                Make the random KSVs reproducible: the KSV number i is a function of
+                            the seed and i only, so equal seeds give equal output for any number
+                            of threads. Also applies to the single KSV when '--count' is not set.
+                            [default: a random seed]
+  --threads <n>             Number of worker threads. The output order does not depend on it.
+                            [default: number of hardware threads]
   -h, --help                Show this help message and exit.
 
 Output Formats:
@@ -148,10 +464,18 @@ Output Formats:
   toml                  : KSV, generated source device key, and generated sink device key as TOML.
   toml_full             : KSV, generated source device key, generated sink device key,
                           and the derived HDCP shared key as TOML.
+  jsonl                 : KSV, generated source device key, and generated sink device key as one
+                          compact JSON object on a single line (JSON Lines).
+  jsonl_full            : KSV, generated source device key, generated sink device key,
+                          and the derived HDCP shared key as one compact JSON object on a single line.
 
 Examples:
   hdcp-gen-key -k 00000fffff -o json_full
   hdcp-gen-key --out text_line_source
+  hdcp-gen-key --count 100000 > keysets.jsonl
+  hdcp-gen-key --ksv-file manifest.txt > keysets.jsonl
+  hdcp-gen-key --validate manifest.txt
+  hdcp-gen-key --enumerate --from 1000000 --count 5000 --threads 8 -o text_line_source
 )";
     std::cout << help << std::endl;
 }
\ No newline at end of file
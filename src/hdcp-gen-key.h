@@ -38,9 +38,52 @@
 #ifndef HDCP_GEN_KEY_H
 #define HDCP_GEN_KEY_H
 
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Identifiers of the options that have no short form.
+*/
+enum long_only_option
+{
+    OPT_BENCHMARK = 256,
+    OPT_ENUMERATE,
+    OPT_FROM,
+    OPT_COUNT,
+    OPT_THREADS,
+    OPT_COMPLEMENT,
+    OPT_SEED,
+    OPT_UNIQUE,
+    OPT_EXCLUDE,
+    OPT_KSV_FILE,
+    OPT_TO_BINARY,
+    OPT_VALIDATE
+};
+
 /**
  * @brief Prints help information that is invoked by `-h` or `--help`
 */
 void print_help();
 
+/**
+ * @brief Prints an error message to the standard error and exits with code 1.
+ * @param[in] message The message.
+*/
+[[noreturn]] void fatal_error(std::string const &message);
+
+/**
+ * @brief Prints an invalid command-line usage message and exits with code 1.
+ * @param[in] message The message.
+*/
+[[noreturn]] void usage_error(std::string const &message);
+
+/**
+ * @brief Converts an option argument to an unsigned 64-bit number.
+ * @param[in] name The option name, used in the error message.
+ * @param[in] s The option argument (decimal).
+ * @return The number.
+ * @note Exits through `usage_error()` if `s` is not a decimal number or does not fit.
+*/
+std::uint64_t parse_uint64_option(std::string const &name, char const *s);
+
 #endif // HDCP_GEN_KEY_H
\ No newline at end of file
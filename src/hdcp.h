@@ -32,6 +32,11 @@
 
 #include <array>
 #include <bitset>
+#include <cstdint>
+#include <string>
+
+#include "master-matrix.h"
+#include "output-buffer.h"
 
 /**
  * @brief Generates the source HDCP key (HDCP versions 1.0-1.4).
@@ -51,6 +56,151 @@ std::array<std::bitset<56>, 40> generate_source(std::bitset<40> const &ksv, std:
 */
 std::array<std::bitset<56>, 40> generate_sink(std::bitset<40> const &ksv, std::array<std::bitset<56>, 1600> const &key);
 
+/**
+ * @brief Generates the source HDCP key (HDCP versions 1.0-1.4) from the packed Master Key Matrix.
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @param[in] key The packed Master Key Matrix.
+ * @return The source HDCP key.
+ * @warning Supports not valid ksv keys.
+*/
+std::array<std::bitset<56>, 40> generate_source(std::bitset<40> const &ksv, master_matrix const &key);
+
+/**
+ * @brief Generates the sink HDCP key (HDCP versions 1.0-1.4) from the packed Master Key Matrix.
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @param[in] key The packed Master Key Matrix.
+ * @return The sink HDCP key.
+ * @warning Supports not valid ksv keys.
+*/
+std::array<std::bitset<56>, 40> generate_sink(std::bitset<40> const &ksv, master_matrix const &key);
+
+/**
+ * @brief Generates the source HDCP key (HDCP versions 1.0-1.4) from the packed Master Key Matrix.
+ * @param[in] ksv Key Selection Vector (KSV), 40 bits.
+ * @param[in] key The packed Master Key Matrix.
+ * @return The source HDCP key, 56 bits per value.
+ * @warning Supports not valid ksv keys.
+ *
+ * @note The function is `constexpr`: keys of a fixed KSV can be generated at compile time,
+ * e.g. `constexpr auto source = generate_source(0x00000fffff, intel_master_matrix);`.
+*/
+constexpr std::array<std::uint64_t, 40> generate_source(std::uint64_t ksv, master_matrix const &key)
+{
+    std::array<std::uint64_t, 40> result = {};
+
+    for(std::size_t z = 0; z < 40; z++)
+    {
+        if((ksv >> z) & 1)
+        {
+            std::uint64_t const *row = key.row(z);
+            for(std::size_t i = 0; i < 40; i++)
+            {
+                result[i] += row[i];
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < 40; i++)
+    {
+        result[i] &= 0xffffffffffffff;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Generates the sink HDCP key (HDCP versions 1.0-1.4) from the packed Master Key Matrix.
+ * @param[in] ksv Key Selection Vector (KSV), 40 bits.
+ * @param[in] key The packed Master Key Matrix.
+ * @return The sink HDCP key, 56 bits per value.
+ * @warning Supports not valid ksv keys.
+ *
+ * @note The function is `constexpr`, see `generate_source()`.
+*/
+constexpr std::array<std::uint64_t, 40> generate_sink(std::uint64_t ksv, master_matrix const &key)
+{
+    std::array<std::uint64_t, 40> result = {};
+
+    for(std::size_t z = 0; z < 40; z++)
+    {
+        if((ksv >> z) & 1)
+        {
+            std::uint64_t const *column = key.column(z);
+            for(std::size_t i = 0; i < 40; i++)
+            {
+                result[i] += column[i];
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < 40; i++)
+    {
+        result[i] &= 0xffffffffffffff;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Source and sink HDCP keys generated from one KSV.
+*/
+struct hdcp_keyset
+{
+    std::array<std::uint64_t, 40> source; ///< The source HDCP key.
+    std::array<std::uint64_t, 40> sink;   ///< The sink HDCP key.
+};
+
+/**
+ * @brief Generates the source and sink HDCP keys (HDCP versions 1.0-1.4) in a single pass over the Master Key Matrix.
+ * @details The set KSV bits are extracted once, then every selected row and column is added to both keys
+ * by the fastest kernel that the running CPU supports.
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @param[in] key The packed Master Key Matrix.
+ * @return The source and sink HDCP keys.
+ * @warning Supports not valid ksv keys.
+ * @see nibble_table::generate_keyset() for the table-driven derivation that the bulk modes use.
+*/
+hdcp_keyset generate_keyset(std::bitset<40> const &ksv, master_matrix const &key);
+
+/**
+ * @brief Generates the source and sink HDCP keys (HDCP versions 1.0-1.4) without branching on KSV bits.
+ * @details
+ *
+ * Every KSV bit is turned into an all-ones or all-zeros mask and every row and column of the Master Key Matrix
+ * is added under its mask. Nothing mispredicts on random KSVs, and the memory accesses and the instruction stream
+ * do not depend on the KSV, so the timing does not leak key material.
+ *
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @param[in] key The packed Master Key Matrix.
+ * @return The source and sink HDCP keys.
+ * @warning Supports not valid ksv keys.
+*/
+hdcp_keyset generate_keyset_masked(std::bitset<40> const &ksv, master_matrix const &key);
+
+/**
+ * @brief Returns the source and sink HDCP keys of the complement KSV.
+ * @details
+ *
+ * The complement `~ksv` selects exactly the rows and columns that `ksv` does not, so its keys are
+ * the totals of the Master Key Matrix minus the keys of `ksv`, modulo 2^56. The complement of a valid KSV is valid.
+ *
+ * @param[in] keys The source and sink HDCP keys of a KSV.
+ * @param[in] key The packed Master Key Matrix.
+ * @return The source and sink HDCP keys of the complement KSV.
+*/
+constexpr hdcp_keyset complement_keyset(hdcp_keyset const &keys, master_matrix const &key)
+{
+    hdcp_keyset result = {};
+
+    for(std::size_t i = 0; i < 40; i++)
+    {
+        result.source[i] = (key.source_total()[i] - keys.source[i]) & 0xffffffffffffff;
+        result.sink[i]   = (key.sink_total()[i] - keys.sink[i]) & 0xffffffffffffff;
+    }
+
+    return result;
+}
+
 /**
  * @brief Converts a `std::bitset` to its hexadecimal string representation.
  *
@@ -67,6 +217,36 @@ std::array<std::bitset<56>, 40> generate_sink(std::bitset<40> const &ksv, std::a
 template<std::size_t bits>
 std::string bitset_to_hex(std::bitset<bits> const &num);
 
+/**
+ * @brief Converts a number to its hexadecimal digits, the `constexpr` counterpart of `bitset_to_hex()`.
+ *
+ * @tparam bits The number of bits to convert.
+ * @param[in] num The number to convert. Bits above `bits` are ignored.
+ * @return The lowercase hexadecimal digits, most significant first, without a terminating null character.
+ *
+ * @pre The template parameter `bits` must be greater than 0.
+ * @pre The template parameter `bits` must be a multiple of 4.
+ * @pre The template parameter `bits` must be less or equal 64.
+*/
+template<std::size_t bits>
+constexpr std::array<char, bits / 4> hex_digits(std::uint64_t num)
+{
+    static_assert(bits > 0, "bits cannot be 0");
+    static_assert(bits % 4 == 0, "bits must be a multiple of 4");
+    static_assert(bits <= 64, "bits must be less or equal 64");
+
+    constexpr char hex_map[] = "0123456789abcdef";
+
+    std::array<char, bits / 4> result = {};
+
+    for(std::size_t i = 0; i < bits / 4; i++)
+    {
+        result[i] = hex_map[(num >> (bits - 4 - i * 4)) & 0xf];
+    }
+
+    return result;
+}
+
 /**
  * @brief Converts a `std::string` to its `std::bitset` representation.
  *
@@ -80,15 +260,16 @@ std::string bitset_to_hex(std::bitset<bits> const &num);
  * @pre The template parameter `bits` must be only 40, 56 or 64. To add new values, add an overload in `hdcp.cpp`.
  *
  * @note For example, a string `abcd` (hex) would be converted to '1010101111001101' (binary).
+ * @note Returns 0 if the string is not a hexadecimal number of up to `bits / 4` digits; use parse_hex() to get the error.
 */
 template<std::size_t bits>
 std::bitset<bits> ksv_string_to_bitset(std::string const &s);
 
 /**
- * @brief Checks if the provided ksv is correct.
+ * @brief Checks if the provided ksv is correct, i.e. has exactly twenty '1's.
  *
  * @param[in] ksv Key Selection Vector (KSV).
- * @return True if the ksv is correct, false if it is not. 
+ * @return True if the ksv is correct, false if it is not.
  *
  * @note Example: `0x00000fffff` is correct (true), but `0x00000aaaa0` is not (false).
 */
@@ -97,6 +278,7 @@ bool check_ksv(std::bitset<40> const &ksv);
 /**
  * @brief Generates a random valid 40-bit Key Selection Vector (KSV).
  * @return A random valid 40-bit KSV.
+ * @see ksv_generator::local()
  */
 std::bitset<40> random_ksv();
 
@@ -121,6 +303,8 @@ enum formatted_out_type
     XML_FULL,
     TOML,
     TOML_FULL,
+    JSONL,
+    JSONL_FULL,
     NOT_FOUND
 };
 
@@ -139,14 +323,22 @@ class hdcp
 public:
     /**
      * @brief Constructs an hdcp object and initializes its internal state.
-     * @param[in] key Array that contains Master Key Matrix.
+     * @param[in] key The packed Master Key Matrix.
      * @param[in] ksv Key Selection Vector (KSV).
     */
-    hdcp(std::array<std::bitset<56>, 1600> const &key, std::bitset<40> const &ksv) : hdcp_key(key), ksv(ksv)
+    hdcp(master_matrix const &key, std::bitset<40> const &ksv) : hdcp_key(key), ksv(ksv), keys(generate_keyset(ksv, key))
     {
-        source = generate_source(ksv, hdcp_key);
-        sink   = generate_sink(ksv, hdcp_key);
-    };
+    }
+
+    /**
+     * @brief Constructs an hdcp object from already generated keys.
+     * @param[in] key The packed Master Key Matrix.
+     * @param[in] ksv Key Selection Vector (KSV).
+     * @param[in] keys The source and sink HDCP keys of `ksv`.
+    */
+    hdcp(master_matrix const &key, std::bitset<40> const &ksv, hdcp_keyset const &keys) : hdcp_key(key), ksv(ksv), keys(keys)
+    {
+    }
 
     /**
      * @brief Formats the HDCP data (source, sink, KSV) into a string.
@@ -158,11 +350,20 @@ public:
     */
     std::string formatted(formatted_out_type const &t);
 
+    /**
+     * @brief Formats the HDCP data (source, sink, KSV) into an output buffer.
+     * @details The output is the same as formatted(), appended to `out` without temporary strings.
+     * @param[in] t Desired output format.
+     * @param[out] out The output buffer.
+     *
+     * @see formatted()
+    */
+    void format(formatted_out_type const &t, output_buffer &out) const;
+
 private:
-    std::array<std::bitset<56>, 1600> const &hdcp_key;
+    master_matrix const &hdcp_key;
     std::bitset<40> ksv;
-    std::array<std::bitset<56>, 40> source;
-    std::array<std::bitset<56>, 40> sink;
+    hdcp_keyset keys;
 };
 
 #endif // HDCP_H
\ No newline at end of file
@@ -0,0 +1,174 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file hex-encode.cpp
+ * @brief Defines the hexadecimal encoding of KSVs and 56-bit HDCP keys.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "hex-encode.h"
+
+#include "cpu-features.h"
+
+#ifdef HGK_X86_SIMD
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+    void encode_scalar(std::uint64_t const *keys, std::size_t count, char *out)
+    {
+        for(std::size_t i = 0; i < count; i++)
+            encode_hex<56>(keys[i], out + i * key_hex_digits);
+    }
+
+#ifdef HGK_X86_SIMD
+    /*
+     * The vectorized encoders spread the 7 key bytes of a 64-bit lane over 14 output bytes, most significant first,
+     * keep the high nibble at even and the low nibble at odd positions and turn every nibble into its digit with
+     * a table shuffle. Every key is stored with 16 bytes: the 2 extra digits are overwritten by the next key,
+     * except after the last key, which is stored through a temporary.
+    */
+
+    /**
+     * @brief Stores the 14 digits of one key held in the low bytes of a vector.
+     * @param[in] digits The digits.
+     * @param[out] out Receives 14 characters.
+     * @param[in] last True if nothing follows the key in `out`.
+    */
+    __attribute__((target("ssse3"))) inline void store_key_digits(__m128i digits, char *out, bool last)
+    {
+        if(!last)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), digits);
+            return;
+        }
+
+        alignas(16) char temporary[16];
+        _mm_store_si128(reinterpret_cast<__m128i *>(temporary), digits);
+        std::memcpy(out, temporary, key_hex_digits);
+    }
+
+    /**
+     * @brief Turns spread key bytes into digits: the high nibble at even and the low nibble at odd positions.
+    */
+    __attribute__((target("ssse3"))) inline __m128i key_digits_ssse3(__m128i spread)
+    {
+        __m128i const odd   = _mm_set1_epi16(static_cast<short>(0xff00));
+        __m128i const low   = _mm_set1_epi8(0x0f);
+        __m128i const table = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+        __m128i const high    = _mm_and_si128(_mm_srli_epi16(spread, 4), low);
+        __m128i const nibbles = _mm_or_si128(_mm_and_si128(odd, _mm_and_si128(spread, low)), _mm_andnot_si128(odd, high));
+
+        return _mm_shuffle_epi8(table, nibbles);
+    }
+
+    __attribute__((target("ssse3"))) void encode_ssse3(std::uint64_t const *keys, std::size_t count, char *out)
+    {
+        __m128i const first  = _mm_setr_epi8(6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, -1, -1);
+        __m128i const second = _mm_setr_epi8(14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8, -1, -1);
+
+        std::size_t i = 0;
+
+        for(; i + 2 <= count; i += 2)
+        {
+            __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(keys + i));
+
+            store_key_digits(key_digits_ssse3(_mm_shuffle_epi8(x, first)), out + i * key_hex_digits, false);
+            store_key_digits(key_digits_ssse3(_mm_shuffle_epi8(x, second)), out + (i + 1) * key_hex_digits, i + 2 == count);
+        }
+
+        encode_scalar(keys + i, count - i, out + i * key_hex_digits);
+    }
+
+    /**
+     * @brief Turns spread key bytes into digits, see key_digits_ssse3().
+    */
+    __attribute__((target("avx2"))) inline __m256i key_digits_avx2(__m256i spread)
+    {
+        __m256i const odd   = _mm256_set1_epi16(static_cast<short>(0xff00));
+        __m256i const low   = _mm256_set1_epi8(0x0f);
+        __m256i const table = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+                                               '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+        __m256i const high = _mm256_and_si256(_mm256_srli_epi16(spread, 4), low);
+
+        return _mm256_shuffle_epi8(table, _mm256_blendv_epi8(high, _mm256_and_si256(spread, low), odd));
+    }
+
+    __attribute__((target("avx2"))) void encode_avx2(std::uint64_t const *keys, std::size_t count, char *out)
+    {
+        __m256i const first  = _mm256_setr_epi8(6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, -1, -1, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, -1, -1);
+        __m256i const second = _mm256_setr_epi8(14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8, -1, -1, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8, -1, -1);
+
+        std::size_t i = 0;
+
+        // Keys i and i + 1 are in the low lane, keys i + 2 and i + 3 in the high lane
+        for(; i + 4 <= count; i += 4)
+        {
+            __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(keys + i));
+            __m256i const a = key_digits_avx2(_mm256_shuffle_epi8(x, first));
+            __m256i const b = key_digits_avx2(_mm256_shuffle_epi8(x, second));
+
+            char *const p = out + i * key_hex_digits;
+
+            store_key_digits(_mm256_castsi256_si128(a), p, false);
+            store_key_digits(_mm256_castsi256_si128(b), p + key_hex_digits, false);
+            store_key_digits(_mm256_extracti128_si256(a, 1), p + 2 * key_hex_digits, false);
+            store_key_digits(_mm256_extracti128_si256(b, 1), p + 3 * key_hex_digits, i + 4 == count);
+        }
+
+        encode_scalar(keys + i, count - i, out + i * key_hex_digits);
+    }
+#endif
+
+    hex_encoder const scalar_encoder = {"scalar", encode_scalar};
+
+#ifdef HGK_X86_SIMD
+    hex_encoder const ssse3_encoder = {"ssse3", encode_ssse3};
+    hex_encoder const avx2_encoder  = {"avx2", encode_avx2};
+#endif
+} // namespace
+
+std::vector<hex_encoder> supported_hex_encoders()
+{
+    std::vector<hex_encoder> result = {scalar_encoder};
+
+#ifdef HGK_X86_SIMD
+    if(cpu_has_ssse3())
+        result.push_back(ssse3_encoder);
+
+    if(cpu_has_avx2())
+        result.push_back(avx2_encoder);
+#endif
+
+    return result;
+}
+
+hex_encoder const &best_hex_encoder()
+{
+    static hex_encoder const best = supported_hex_encoders().back();
+    return best;
+}
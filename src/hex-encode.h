@@ -0,0 +1,139 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file hex-encode.h
+ * @brief Defines the hexadecimal encoding of KSVs and 56-bit HDCP keys.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef HEX_ENCODE_H
+#define HEX_ENCODE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Number of hexadecimal digits of a 56-bit HDCP key.
+*/
+constexpr std::size_t key_hex_digits = 14;
+
+/**
+ * @brief Number of hexadecimal digits of a 40-bit KSV.
+*/
+constexpr std::size_t ksv_hex_digits = 10;
+
+/**
+ * @brief Builds the table of the two lowercase hexadecimal digits of every byte value.
+*/
+constexpr std::array<char, 512> make_hex_byte_table()
+{
+    constexpr char hex_map[] = "0123456789abcdef";
+
+    std::array<char, 512> result = {};
+
+    for(std::size_t i = 0; i < 256; i++)
+    {
+        result[i * 2]     = hex_map[i >> 4];
+        result[i * 2 + 1] = hex_map[i & 0xf];
+    }
+
+    return result;
+}
+
+/**
+ * @brief The two lowercase hexadecimal digits of every byte value, at `2 * byte`.
+*/
+inline constexpr std::array<char, 512> hex_byte_table = make_hex_byte_table();
+
+/**
+ * @brief Writes the lowercase hexadecimal digits of a number, most significant first, one table lookup per byte.
+ *
+ * @tparam bits The number of bits to convert.
+ * @param[in] num The number to convert. Bits above `bits` are ignored.
+ * @param[out] out Receives `bits / 4` characters, without a terminating null character.
+ *
+ * @pre The template parameter `bits` must be a multiple of 8 and less or equal 64.
+*/
+template<std::size_t bits>
+inline void encode_hex(std::uint64_t num, char *out)
+{
+    static_assert(bits > 0, "bits cannot be 0");
+    static_assert(bits % 8 == 0, "bits must be a multiple of 8");
+    static_assert(bits <= 64, "bits must be less or equal 64");
+
+    for(std::size_t i = 0; i < bits / 8; i++)
+    {
+        std::memcpy(out + i * 2, hex_byte_table.data() + ((num >> (bits - 8 - i * 8)) & 0xff) * 2, 2);
+    }
+}
+
+/**
+ * @brief A hexadecimal encoder of 56-bit HDCP keys.
+ * @details
+ *
+ * An encoder writes the `key_hex_digits` lowercase digits of every key back to back, without separators.
+ * The scalar encoder is always available and is the reference for the vectorized ones.
+*/
+struct hex_encoder
+{
+    /**
+     * @brief Encoder name.
+    */
+    char const *name;
+
+    /**
+     * @brief Encodes HDCP keys.
+     * @param[in] keys The 56-bit keys. Bits above 56 are ignored.
+     * @param[in] count Number of keys.
+     * @param[out] out Receives `count * key_hex_digits` characters.
+    */
+    void (*encode)(std::uint64_t const *keys, std::size_t count, char *out);
+};
+
+/**
+ * @brief Returns every encoder that the running CPU supports, the scalar encoder first.
+*/
+std::vector<hex_encoder> supported_hex_encoders();
+
+/**
+ * @brief Returns the fastest encoder that the running CPU supports.
+ * @note The CPU is checked (cpuid) only on the first call.
+*/
+hex_encoder const &best_hex_encoder();
+
+/**
+ * @brief Encodes HDCP keys with the fastest encoder, see hex_encoder.
+ * @param[in] keys The 56-bit keys.
+ * @param[in] count Number of keys.
+ * @param[out] out Receives `count * key_hex_digits` characters.
+*/
+inline void encode_key_hex(std::uint64_t const *keys, std::size_t count, char *out)
+{
+    best_hex_encoder().encode(keys, count, out);
+}
+
+#endif // HEX_ENCODE_H
@@ -0,0 +1,100 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-batch.cpp
+ * @brief Defines batch HDCP key derivation into struct-of-arrays buffers.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "keyset-batch.h"
+
+#include <array>
+#include <new>
+
+#include "hdcp.h"
+
+keyset_batch::keyset_batch(std::size_t capacity) : max_count(capacity), row_stride((capacity + 7) / 8 * 8), data(nullptr)
+{
+    // 8 values per row stride keep every row on a 64-byte boundary
+    std::size_t const bytes = 80 * row_stride * sizeof(std::uint64_t);
+    data                    = static_cast<std::uint64_t *>(::operator new(bytes == 0 ? 64 : bytes, std::align_val_t(64)));
+}
+
+keyset_batch::~keyset_batch()
+{
+    ::operator delete(data, std::align_val_t(64));
+}
+
+void generate_batch(std::uint64_t const *ksvs, std::size_t count, nibble_table const &table, keyset_batch &out)
+{
+    // Keysets are derived in tiles of 8 KSVs, so every write to `out` fills a whole cache line of a key row
+    constexpr std::size_t tile_size = 8;
+
+    std::array<hdcp_keyset, tile_size> tile;
+
+    for(std::size_t first = 0; first < count; first += tile_size)
+    {
+        std::size_t const n = count - first < tile_size ? count - first : tile_size;
+
+        for(std::size_t k = 0; k < n; k++)
+            tile[k] = table.generate_keyset(ksvs[first + k]);
+
+        for(std::size_t i = 0; i < 40; i++)
+        {
+            std::uint64_t *source = out.source(i) + first;
+            std::uint64_t *sink   = out.sink(i) + first;
+
+            for(std::size_t k = 0; k < n; k++)
+            {
+                source[k] = tile[k].source[i];
+                sink[k]   = tile[k].sink[i];
+            }
+        }
+    }
+}
+
+void complement_batch(std::size_t count, master_matrix const &key, keyset_batch const &keys, keyset_batch &out)
+{
+    for(std::size_t i = 0; i < 40; i++)
+    {
+        std::uint64_t const source_total = key.source_total()[i];
+        std::uint64_t const sink_total   = key.sink_total()[i];
+        std::uint64_t const *source      = keys.source(i);
+        std::uint64_t const *sink        = keys.sink(i);
+        std::uint64_t *source_out        = out.source(i);
+        std::uint64_t *sink_out          = out.sink(i);
+
+        for(std::size_t n = 0; n < count; n++)
+        {
+            source_out[n] = (source_total - source[n]) & 0xffffffffffffff;
+            sink_out[n]   = (sink_total - sink[n]) & 0xffffffffffffff;
+        }
+    }
+}
+
+void generate_batch_complement(std::uint64_t const *ksvs, std::size_t count, nibble_table const &table, keyset_batch &out, keyset_batch &complement)
+{
+    generate_batch(ksvs, count, table, out);
+    complement_batch(count, table.matrix(), out, complement);
+}
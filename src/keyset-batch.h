@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-batch.h
+ * @brief Defines batch HDCP key derivation into struct-of-arrays buffers.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KEYSET_BATCH_H
+#define KEYSET_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "master-matrix.h"
+#include "nibble-table.h"
+
+/**
+ * @brief Caller-owned buffers for the keys of a batch of KSVs in struct-of-arrays layout.
+ * @details
+ *
+ * The buffers are key index major and KSV minor: `source(i)[n]` is the source key value `i` of the KSV `n` of the batch.
+ * Every one of the 80 key rows (40 source, 40 sink) starts on a 64-byte boundary.
+ * The buffers are allocated once by the constructor and reused by every `generate_batch()` call.
+*/
+class keyset_batch
+{
+public:
+    /**
+     * @brief Allocates buffers for up to `capacity` keysets.
+     * @param[in] capacity The maximal number of KSVs in a batch.
+    */
+    explicit keyset_batch(std::size_t capacity);
+
+    ~keyset_batch();
+
+    keyset_batch(keyset_batch const &)            = delete;
+    keyset_batch &operator=(keyset_batch const &) = delete;
+
+    /**
+     * @brief Returns the maximal number of KSVs in a batch.
+    */
+    std::size_t capacity() const
+    {
+        return max_count;
+    }
+
+    /**
+     * @brief Returns the distance in values between two consecutive key rows.
+    */
+    std::size_t stride() const
+    {
+        return row_stride;
+    }
+
+    /**
+     * @brief Returns the source key value `i` of every KSV of the batch.
+     * @param[in] i Key value index (0-39).
+    */
+    std::uint64_t *source(std::size_t i)
+    {
+        return data + i * row_stride;
+    }
+
+    /**
+     * @copydoc source(std::size_t)
+    */
+    std::uint64_t const *source(std::size_t i) const
+    {
+        return data + i * row_stride;
+    }
+
+    /**
+     * @brief Returns the sink key value `i` of every KSV of the batch.
+     * @param[in] i Key value index (0-39).
+    */
+    std::uint64_t *sink(std::size_t i)
+    {
+        return data + (40 + i) * row_stride;
+    }
+
+    /**
+     * @copydoc sink(std::size_t)
+    */
+    std::uint64_t const *sink(std::size_t i) const
+    {
+        return data + (40 + i) * row_stride;
+    }
+
+private:
+    std::size_t max_count;
+    std::size_t row_stride;
+    std::uint64_t *data;
+};
+
+/**
+ * @brief Generates the source and sink HDCP keys (HDCP versions 1.0-1.4) of many KSVs.
+ * @details
+ *
+ * Every keyset is derived from the nibble table (see nibble_table::generate_keyset()) and tiles of 8 keysets
+ * are transposed into the batch rows. Nothing is allocated and no key is returned by value;
+ * the table entries stay hot in cache for the whole batch.
+ *
+ * @param[in] ksvs Key Selection Vectors (KSVs), 40 bits each.
+ * @param[in] count Number of KSVs.
+ * @param[in] table The nibble table of the Master Key Matrix.
+ * @param[out] out The keys of the batch.
+ * @pre `count` is less or equal `out.capacity()`.
+ * @warning Supports not valid ksv keys.
+*/
+void generate_batch(std::uint64_t const *ksvs, std::size_t count, nibble_table const &table, keyset_batch &out);
+
+/**
+ * @brief Computes the keys of the complement of every KSV of a batch.
+ * @details
+ *
+ * `out` receives the keys of `~ksvs[n]`: the totals of the Master Key Matrix minus the keys in `keys`, modulo 2^56.
+ * This is one subtraction per key value instead of a derivation.
+ *
+ * @param[in] count Number of KSVs.
+ * @param[in] key The packed Master Key Matrix.
+ * @param[in] keys The keys of the batch.
+ * @param[out] out The keys of the complements. May be `keys` itself.
+ * @pre `count` is less or equal `keys.capacity()` and `out.capacity()`.
+ * @see complement_keyset()
+*/
+void complement_batch(std::size_t count, master_matrix const &key, keyset_batch const &keys, keyset_batch &out);
+
+/**
+ * @brief Generates the source and sink HDCP keys of many KSVs and of their complements.
+ * @details
+ *
+ * Yields `2 * count` keysets for the cost of `count` derivations.
+ *
+ * @param[in] ksvs Key Selection Vectors (KSVs), 40 bits each.
+ * @param[in] count Number of KSVs.
+ * @param[in] table The nibble table of the Master Key Matrix.
+ * @param[out] out The keys of the batch.
+ * @param[out] complement The keys of the complements `~ksvs[n]`.
+ * @pre `count` is less or equal `out.capacity()` and `complement.capacity()`.
+ * @warning Supports not valid ksv keys.
+*/
+void generate_batch_complement(std::uint64_t const *ksvs, std::size_t count, nibble_table const &table, keyset_batch &out, keyset_batch &complement);
+
+#endif // KEYSET_BATCH_H
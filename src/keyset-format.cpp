@@ -0,0 +1,369 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-format.cpp
+ * @brief Defines the keyset formatters: one specialized writer with an exact output size per output format.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "keyset-format.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#include "hex-encode.h"
+
+namespace
+{
+    /**
+     * @brief The layout of a list of 56-bit keys.
+    */
+    struct key_list_layout
+    {
+        bool present = false;        ///< False if the format does not write the list.
+        std::string_view before;     ///< Written before the list.
+        std::string_view prefix;     ///< Written before every key.
+        std::string_view separator;  ///< Written after every key, except at row ends and after the last key.
+        std::string_view row_end;    ///< Written after every `columns`-th key, except after the last key.
+        std::size_t columns = 0;     ///< Keys per row, 0 if the list has no rows.
+        std::string_view last;       ///< Written after the last key.
+    };
+
+    /**
+     * @brief The layout of a formatted keyset: head, KSV, source, sink, Master Key Matrix, tail.
+    */
+    struct keyset_layout
+    {
+        std::string_view head;  ///< Written first.
+        bool ksv = false;       ///< True if the format writes the KSV after the head.
+        key_list_layout source; ///< The source HDCP key.
+        key_list_layout sink;   ///< The sink HDCP key.
+        key_list_layout matrix; ///< The Master Key Matrix in row-major order.
+        std::string_view tail;  ///< Written last.
+    };
+
+    /**
+     * @brief A table with 5 columns separated by a new line. Each value is separated by a space.
+    */
+    constexpr key_list_layout key_table(std::string_view before)
+    {
+        return {true, before, "", " ", "\n", 5, "\n"};
+    }
+
+    /**
+     * @brief A list of keys between a prefix and a suffix.
+    */
+    constexpr key_list_layout key_items(std::string_view before, std::string_view prefix, std::string_view suffix)
+    {
+        return {true, before, prefix, suffix, "", 0, suffix};
+    }
+
+    /**
+     * @brief A list of keys between a prefix and a suffix, with a different suffix after the last key.
+    */
+    constexpr key_list_layout key_items(std::string_view before, std::string_view prefix, std::string_view suffix, std::string_view last)
+    {
+        return {true, before, prefix, suffix, "", 0, last};
+    }
+
+    /**
+     * @brief Returns the layout of an output format.
+    */
+    constexpr keyset_layout layout_of(formatted_out_type t)
+    {
+        keyset_layout result;
+
+        switch(t)
+        {
+            case TEXT_INFORMATIONAL:
+            case TEXT_FULL:
+                result.head   = "ksv: ";
+                result.ksv    = true;
+                result.source = key_table("\n\nSource:\n");
+                result.sink   = key_table("\nSink:\n");
+
+                if(t == TEXT_FULL)
+                    result.matrix = key_table("\nHDCP key:\n");
+                break;
+            case TEXT_SOURCE_ONLY:
+                result.source = key_table("Source:\n");
+                break;
+            case TEXT_SINK_ONLY:
+                result.sink = key_table("Sink:\n");
+                break;
+            case TEXT_SOURCE_KSV_ONLY:
+                result.head   = "ksv: ";
+                result.ksv    = true;
+                result.source = key_table("\n\nSource:\n");
+                break;
+            case TEXT_SINK_KSV_ONLY:
+                result.head = "ksv: ";
+                result.ksv  = true;
+                result.sink = key_table("\n\nSink:\n");
+                break;
+            case TEXT_LINE_SOURCE:
+                result.source = key_items("", "", " ");
+                break;
+            case TEXT_LINE_SINK:
+                result.sink = key_items("", "", " ");
+                break;
+            case JSON:
+            case JSON_FULL:
+                result.head   = "{\n    \"ksv\":\"";
+                result.ksv    = true;
+                result.source = key_items("\",\n    \"source\":\n    [\n", "        \"", "\",\n", "\"\n");
+                result.sink   = key_items("    ],\n    \"sink\":\n    [\n", "        \"", "\",\n", "\"\n");
+                result.tail   = "    ]\n}\n";
+
+                if(t == JSON_FULL)
+                    result.matrix = key_items("    ],\n    \"hdcp_key\":\n    [\n", "        \"", "\",\n", "\"\n");
+                break;
+            case YAML:
+            case YAML_FULL:
+                result.head   = "ksv: ";
+                result.ksv    = true;
+                result.source = key_items("\nsource:\n", "  - ", "\n");
+                result.sink   = key_items("sink:\n", "  - ", "\n");
+
+                if(t == YAML_FULL)
+                    result.matrix = key_items("hdcp_key:\n", "  - ", "\n");
+                break;
+            case XML:
+            case XML_FULL:
+                result.head   = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<hdcp>\n    <ksv>";
+                result.ksv    = true;
+                result.source = key_items("</ksv>\n    <source>\n", "        <item>", "</item>\n");
+                result.sink   = key_items("    </source>\n    <sink>\n", "        <item>", "</item>\n");
+                result.tail   = "    </sink>\n</hdcp>\n";
+
+                if(t == XML_FULL)
+                {
+                    result.matrix = key_items("    </sink>\n    <hdcp_key>\n", "        <item>", "</item>\n");
+                    result.tail   = "    </hdcp_key>\n</hdcp>\n";
+                }
+                break;
+            case TOML:
+            case TOML_FULL:
+                result.head   = "ksv = \"";
+                result.ksv    = true;
+                result.source = key_items("\"\nsource = [\n", "  \"", "\",\n");
+                result.sink   = key_items("]\nsink = [\n", "  \"", "\",\n");
+                result.tail   = "]\n";
+
+                if(t == TOML_FULL)
+                    result.matrix = key_items("]\nhdcp_key = [\n", "  \"", "\",\n");
+                break;
+            case JSONL:
+            case JSONL_FULL:
+                result.head   = "{\"ksv\":\"";
+                result.ksv    = true;
+                result.source = key_items("\",\"source\":[", "\"", "\",", "\"");
+                result.sink   = key_items("],\"sink\":[", "\"", "\",", "\"");
+                result.tail   = "]}\n";
+
+                if(t == JSONL_FULL)
+                    result.matrix = key_items("],\"hdcp_key\":[", "\"", "\",", "\"");
+                break;
+            default:
+                break;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Returns the size of a list of `count` keys in bytes.
+    */
+    constexpr std::size_t list_size(key_list_layout const &list, std::size_t count)
+    {
+        if(!list.present)
+            return 0;
+
+        std::size_t const row_ends = list.columns != 0 ? (count - 1) / list.columns : 0;
+
+        return list.before.size() + count * (list.prefix.size() + key_hex_digits) + row_ends * list.row_end.size() +
+               (count - 1 - row_ends) * list.separator.size() + list.last.size();
+    }
+
+    /**
+     * @brief Returns the size of a formatted keyset in bytes.
+    */
+    constexpr std::size_t keyset_size(keyset_layout const &layout)
+    {
+        return layout.head.size() + (layout.ksv ? ksv_hex_digits : 0) + list_size(layout.source, 40) + list_size(layout.sink, 40) +
+               list_size(layout.matrix, 1600) + layout.tail.size();
+    }
+
+    /**
+     * @brief Returns the last character of a formatted keyset, or 0 if the format writes nothing.
+    */
+    constexpr char last_char(keyset_layout const &layout)
+    {
+        if(!layout.tail.empty())
+            return layout.tail.back();
+
+        if(layout.matrix.present)
+            return layout.matrix.last.back();
+
+        if(layout.sink.present)
+            return layout.sink.last.back();
+
+        if(layout.source.present)
+            return layout.source.last.back();
+
+        if(layout.ksv)
+            return '0';
+
+        return layout.head.empty() ? 0 : layout.head.back();
+    }
+
+    // The sizes match the output of a keyset in the documented formats
+    static_assert(keyset_size(layout_of(TEXT_INFORMATIONAL)) == 1232, "text_informational size");
+    static_assert(keyset_size(layout_of(TEXT_LINE_SOURCE)) == 600, "text_line_source size");
+    static_assert(keyset_size(layout_of(TEXT_FULL)) == 25243, "text_full size");
+    static_assert(keyset_size(layout_of(JSON)) == 2157, "json size");
+    static_assert(keyset_size(layout_of(JSON_FULL)) == 43785, "json_full size");
+    static_assert(keyset_size(layout_of(XML)) == 3010, "xml size");
+    static_assert(keyset_size(layout_of(TOML_FULL)) == 33658, "toml_full size");
+    static_assert(keyset_size(layout_of(JSONL)) == 1401, "jsonl size");
+    static_assert(keyset_size(layout_of(JSONL_FULL)) == 28614, "jsonl_full size");
+
+    /**
+     * @brief Copies text and returns the position after it.
+    */
+    inline char *write_text(char *out, std::string_view s)
+    {
+        std::memcpy(out, s.data(), s.size());
+        return out + s.size();
+    }
+
+    /**
+     * @brief Writes a list of keys and returns the position after it.
+     *
+     * @tparam t Output format.
+     * @tparam list The list in the layout of `t`.
+     * @tparam count Number of keys.
+     * @param[out] out The output.
+     * @param[in] keys The 56-bit keys.
+     * @return The position after the list.
+    */
+    template<formatted_out_type t, key_list_layout keyset_layout::*list, std::size_t count>
+    inline char *write_keys(char *out, std::uint64_t const *keys)
+    {
+        constexpr key_list_layout layout    = layout_of(t).*list;
+        constexpr std::size_t keys_per_chunk = 40;
+
+        // Lists without rows never reach a row end
+        constexpr std::size_t columns = layout.columns != 0 ? layout.columns : count + 1;
+
+        static_assert(count % keys_per_chunk == 0, "keys are encoded in whole chunks");
+
+        std::array<char, keys_per_chunk * key_hex_digits> digits;
+
+        out = write_text(out, layout.before);
+
+        for(std::size_t first = 0; first < count; first += keys_per_chunk)
+        {
+            encode_key_hex(keys + first, keys_per_chunk, digits.data());
+
+            for(std::size_t i = 0; i < keys_per_chunk; i++)
+            {
+                std::size_t const n = first + i + 1;
+
+                out = write_text(out, layout.prefix);
+                std::memcpy(out, digits.data() + i * key_hex_digits, key_hex_digits);
+                out += key_hex_digits;
+
+                if(n == count)
+                    out = write_text(out, layout.last);
+                else if(n % columns == 0)
+                    out = write_text(out, layout.row_end);
+                else
+                    out = write_text(out, layout.separator);
+            }
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Formats a keyset in the output format `t`.
+     * @see keyset_formatter::write
+    */
+    template<formatted_out_type t>
+    void write_keyset(std::uint64_t ksv, hdcp_keyset const &keys, master_matrix const &key, char *out)
+    {
+        constexpr keyset_layout layout = layout_of(t);
+
+        out = write_text(out, layout.head);
+
+        if constexpr(layout.ksv)
+        {
+            encode_hex<40>(ksv, out);
+            out += ksv_hex_digits;
+        }
+
+        if constexpr(layout.source.present)
+            out = write_keys<t, &keyset_layout::source, 40>(out, keys.source.data());
+
+        if constexpr(layout.sink.present)
+            out = write_keys<t, &keyset_layout::sink, 40>(out, keys.sink.data());
+
+        if constexpr(layout.matrix.present)
+            out = write_keys<t, &keyset_layout::matrix, 1600>(out, key.row_major().data());
+
+        write_text(out, layout.tail);
+    }
+
+    /**
+     * @brief Returns the formatter of the output format `t`.
+    */
+    template<formatted_out_type t>
+    constexpr keyset_formatter make_formatter()
+    {
+        constexpr keyset_layout layout = layout_of(t);
+        constexpr std::size_t size     = keyset_size(layout);
+
+        return {size, last_char(layout) == '\n' ? size : size + 1, write_keyset<t>};
+    }
+
+    template<std::size_t... i>
+    constexpr std::array<keyset_formatter, sizeof...(i)> make_formatters(std::index_sequence<i...>)
+    {
+        return {make_formatter<static_cast<formatted_out_type>(i)>()...};
+    }
+
+    /**
+     * @brief The formatters of every output format, `NOT_FOUND` included, indexed by format.
+    */
+    constexpr std::array<keyset_formatter, NOT_FOUND + 1> formatters = make_formatters(std::make_index_sequence<NOT_FOUND + 1>());
+} // namespace
+
+keyset_formatter const &keyset_formatter_of(formatted_out_type t)
+{
+    return formatters[std::min<std::size_t>(t, NOT_FOUND)];
+}
@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-format.h
+ * @brief Defines the keyset formatters: one specialized writer with an exact output size per output format.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KEYSET_FORMAT_H
+#define KEYSET_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "hdcp.h"
+#include "master-matrix.h"
+
+/**
+ * @brief A keyset formatter of one output format.
+ * @details
+ *
+ * Every output format has fixed-width fields, so the size of a formatted keyset is known in advance.
+ * A formatter is generated at compile time for every format; look it up once with keyset_formatter_of()
+ * and call `write` for every keyset.
+*/
+struct keyset_formatter
+{
+    /**
+     * @brief The exact size of a formatted keyset in bytes.
+    */
+    std::size_t size;
+
+    /**
+     * @brief The size of a formatted keyset followed by a new line if it does not end with one.
+    */
+    std::size_t record_size;
+
+    /**
+     * @brief Formats a keyset.
+     * @param[in] ksv Key Selection Vector (KSV).
+     * @param[in] keys The source and sink HDCP keys of `ksv`.
+     * @param[in] key The packed Master Key Matrix (written by the `*_FULL` formats).
+     * @param[out] out Receives exactly `size` characters.
+    */
+    void (*write)(std::uint64_t ksv, hdcp_keyset const &keys, master_matrix const &key, char *out);
+};
+
+/**
+ * @brief Returns the formatter of an output format.
+ * @param[in] t Output format. `NOT_FOUND` returns a formatter that writes nothing.
+*/
+keyset_formatter const &keyset_formatter_of(formatted_out_type t);
+
+#endif // KEYSET_FORMAT_H
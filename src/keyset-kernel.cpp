@@ -0,0 +1,173 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-kernel.cpp
+ * @brief Defines the keyset derivation kernels (scalar, AVX2, AVX-512) and their runtime selection.
+ * @details
+ *
+ * The vectorized kernels are compiled with function-level target attributes,
+ * so one binary runs on every x86-64 CPU and uses the widest vectors the CPU supports.
+ *
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "keyset-kernel.h"
+
+#include "cpu-features.h"
+#include "hdcp.h"
+
+#ifdef HGK_X86_SIMD
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+    void derive_scalar(std::uint8_t const *index, std::size_t count, master_matrix const &key, hdcp_keyset &result)
+    {
+        result = {};
+
+        for(std::size_t k = 0; k < count; k++)
+        {
+            std::uint64_t const *row    = key.row(index[k]);
+            std::uint64_t const *column = key.column(index[k]);
+
+            for(std::size_t i = 0; i < 40; i++)
+            {
+                result.source[i] += row[i];
+                result.sink[i] += column[i];
+            }
+        }
+
+        for(std::size_t i = 0; i < 40; i++)
+        {
+            result.source[i] &= 0xffffffffffffff;
+            result.sink[i] &= 0xffffffffffffff;
+        }
+    }
+
+#ifdef HGK_X86_SIMD
+    /**
+     * @brief Sums the selected 40-value rows of `matrix` into `out` with 4-lane vectors.
+     * @details Ten accumulators hold the whole 40-value key, so the key stays in registers.
+    */
+    __attribute__((target("avx2"))) inline void sum_rows_avx2(std::uint8_t const *index, std::size_t count, std::uint64_t const *matrix, std::uint64_t *out)
+    {
+        __m256i acc[10];
+        for(auto &x : acc)
+            x = _mm256_setzero_si256();
+
+        for(std::size_t k = 0; k < count; k++)
+        {
+            __m256i const *row = reinterpret_cast<__m256i const *>(matrix + index[k] * 40);
+
+            for(std::size_t j = 0; j < 10; j++)
+                acc[j] = _mm256_add_epi64(acc[j], _mm256_load_si256(row + j));
+        }
+
+        __m256i const mask = _mm256_set1_epi64x(0xffffffffffffff);
+        for(std::size_t j = 0; j < 10; j++)
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j * 4), _mm256_and_si256(acc[j], mask));
+    }
+
+    __attribute__((target("avx2"))) void derive_avx2(std::uint8_t const *index, std::size_t count, master_matrix const &key, hdcp_keyset &result)
+    {
+        // Twenty accumulators do not fit into 16 ymm registers, so the source and sink keys are summed separately
+        sum_rows_avx2(index, count, key.row_major().data(), result.source.data());
+        sum_rows_avx2(index, count, key.column_major().data(), result.sink.data());
+    }
+
+    __attribute__((target("avx512f"))) void derive_avx512(std::uint8_t const *index, std::size_t count, master_matrix const &key, hdcp_keyset &result)
+    {
+        // 5 source and 5 sink accumulators of 8 lanes each
+        __m512i source[5];
+        __m512i sink[5];
+        for(std::size_t j = 0; j < 5; j++)
+        {
+            source[j] = _mm512_setzero_si512();
+            sink[j]   = _mm512_setzero_si512();
+        }
+
+        for(std::size_t k = 0; k < count; k++)
+        {
+            __m512i const *row    = reinterpret_cast<__m512i const *>(key.row(index[k]));
+            __m512i const *column = reinterpret_cast<__m512i const *>(key.column(index[k]));
+
+            for(std::size_t j = 0; j < 5; j++)
+            {
+                source[j] = _mm512_add_epi64(source[j], _mm512_load_si512(row + j));
+                sink[j]   = _mm512_add_epi64(sink[j], _mm512_load_si512(column + j));
+            }
+        }
+
+        __m512i const mask = _mm512_set1_epi64(0xffffffffffffff);
+        for(std::size_t j = 0; j < 5; j++)
+        {
+            _mm512_storeu_si512(result.source.data() + j * 8, _mm512_and_si512(source[j], mask));
+            _mm512_storeu_si512(result.sink.data() + j * 8, _mm512_and_si512(sink[j], mask));
+        }
+    }
+#endif
+
+    keyset_kernel const scalar_kernel = {"scalar", derive_scalar};
+
+#ifdef HGK_X86_SIMD
+    keyset_kernel const avx2_kernel   = {"avx2", derive_avx2};
+    keyset_kernel const avx512_kernel = {"avx512", derive_avx512};
+#endif
+} // namespace
+
+std::size_t set_bit_indices(std::bitset<40> const &ksv, std::array<std::uint8_t, 40> &index)
+{
+    std::uint64_t const bits = ksv.to_ullong();
+    std::size_t count        = 0;
+
+    for(std::size_t z = 0; z < 40; z++)
+    {
+        index[count] = static_cast<std::uint8_t>(z);
+        count += (bits >> z) & 1;
+    }
+
+    return count;
+}
+
+std::vector<keyset_kernel> supported_keyset_kernels()
+{
+    std::vector<keyset_kernel> result = {scalar_kernel};
+
+#ifdef HGK_X86_SIMD
+    if(cpu_has_avx2())
+        result.push_back(avx2_kernel);
+
+    if(cpu_has_avx512())
+        result.push_back(avx512_kernel);
+#endif
+
+    return result;
+}
+
+keyset_kernel const &best_keyset_kernel()
+{
+    static keyset_kernel const best = supported_keyset_kernels().back();
+    return best;
+}
@@ -0,0 +1,86 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-kernel.h
+ * @brief Defines the keyset derivation kernels (scalar, AVX2, AVX-512) and their runtime selection.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KEYSET_KERNEL_H
+#define KEYSET_KERNEL_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+#include "master-matrix.h"
+
+struct hdcp_keyset;
+
+/**
+ * @brief A keyset derivation kernel.
+ * @details
+ *
+ * A kernel adds the Master Key Matrix rows (source) and columns (sink) selected by `count` KSV bit indices
+ * and masks the sums to 56 bits.
+ * The scalar kernel is always available and is the reference for the vectorized ones.
+*/
+struct keyset_kernel
+{
+    /**
+     * @brief Kernel name.
+    */
+    char const *name;
+
+    /**
+     * @brief Derives the source and sink HDCP keys.
+     * @param[in] index Indices of the set KSV bits.
+     * @param[in] count Number of indices.
+     * @param[in] key The packed Master Key Matrix.
+     * @param[out] result The source and sink HDCP keys.
+    */
+    void (*derive)(std::uint8_t const *index, std::size_t count, master_matrix const &key, hdcp_keyset &result);
+};
+
+/**
+ * @brief Extracts the indices of the set KSV bits.
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @param[out] index Indices of the set bits in ascending order.
+ * @return Number of set bits.
+*/
+std::size_t set_bit_indices(std::bitset<40> const &ksv, std::array<std::uint8_t, 40> &index);
+
+/**
+ * @brief Returns every kernel that the running CPU supports, the scalar kernel first.
+*/
+std::vector<keyset_kernel> supported_keyset_kernels();
+
+/**
+ * @brief Returns the fastest kernel that the running CPU supports.
+ * @note The CPU is checked (cpuid) only on the first call.
+*/
+keyset_kernel const &best_keyset_kernel();
+
+#endif // KEYSET_KERNEL_H
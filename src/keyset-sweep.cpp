@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-sweep.cpp
+ * @brief Defines incremental HDCP key derivation for walking many KSVs in a row.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "keyset-sweep.h"
+
+incremental_keyset::incremental_keyset(master_matrix const &key, std::bitset<40> const &ksv) : key(key), bits(0), sums()
+{
+    move_to(ksv);
+}
+
+void incremental_keyset::move_to(std::bitset<40> const &ksv)
+{
+    std::uint64_t const next    = ksv.to_ullong();
+    std::uint64_t const changed = bits ^ next;
+
+    for(std::size_t z = 0; z < 40; z++)
+    {
+        if(((changed >> z) & 1) == 0)
+            continue;
+
+        std::uint64_t const *row    = key.row(z);
+        std::uint64_t const *column = key.column(z);
+
+        if((next >> z) & 1)
+        {
+            for(std::size_t i = 0; i < 40; i++)
+            {
+                sums.source[i] += row[i];
+                sums.sink[i] += column[i];
+            }
+        }
+        else
+        {
+            for(std::size_t i = 0; i < 40; i++)
+            {
+                sums.source[i] -= row[i];
+                sums.sink[i] -= column[i];
+            }
+        }
+    }
+
+    bits = next;
+}
+
+void incremental_keyset::swap_bits(std::size_t out, std::size_t in)
+{
+    std::uint64_t const *row_out    = key.row(out);
+    std::uint64_t const *row_in     = key.row(in);
+    std::uint64_t const *column_out = key.column(out);
+    std::uint64_t const *column_in  = key.column(in);
+
+    for(std::size_t i = 0; i < 40; i++)
+    {
+        sums.source[i] += row_in[i] - row_out[i];
+        sums.sink[i] += column_in[i] - column_out[i];
+    }
+
+    bits ^= (std::uint64_t(1) << out) | (std::uint64_t(1) << in);
+}
+
+void incremental_keyset::keyset(hdcp_keyset &result) const
+{
+    for(std::size_t i = 0; i < 40; i++)
+    {
+        result.source[i] = sums.source[i] & 0xffffffffffffff;
+        result.sink[i]   = sums.sink[i] & 0xffffffffffffff;
+    }
+}
+
+revolving_door_sweep::revolving_door_sweep(master_matrix const &key) : c(), keys(key, std::bitset<40>(0x00000fffff))
+{
+    // R1: c[j] = j - 1, c[t + 1] = n
+    for(std::size_t j = 1; j <= 20; j++)
+        c[j] = j - 1;
+
+    c[21] = 40;
+}
+
+bool revolving_door_sweep::next()
+{
+    // Knuth, Algorithm R for n = 40 and even t = 20
+
+    // R3: the easy case
+    if(c[1] > 0)
+    {
+        keys.swap_bits(c[1], c[1] - 1);
+        c[1]--;
+        return true;
+    }
+
+    std::size_t j = 2;
+
+    while(true)
+    {
+        // R5: try to increase c[j] (here c[j - 1] = j - 2)
+        if(c[j] + 1 < c[j + 1])
+        {
+            keys.swap_bits(j - 2, c[j] + 1);
+            c[j - 1] = c[j];
+            c[j]++;
+            return true;
+        }
+
+        j++;
+        if(j > 20)
+            return false;
+
+        // R4: try to decrease c[j] (here c[j] = c[j - 1] + 1)
+        if(c[j] >= j)
+        {
+            keys.swap_bits(c[j], j - 2);
+            c[j]     = c[j - 1];
+            c[j - 1] = j - 2;
+            return true;
+        }
+
+        // j is odd here and t is even, so j + 1 <= t
+        j++;
+    }
+}
@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file keyset-sweep.h
+ * @brief Defines incremental HDCP key derivation for walking many KSVs in a row.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KEYSET_SWEEP_H
+#define KEYSET_SWEEP_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+#include "hdcp.h"
+#include "master-matrix.h"
+
+/**
+ * @brief Source and sink HDCP keys that are updated incrementally when the KSV changes.
+ * @details
+ *
+ * The keys are kept as unmasked 64-bit sums. Sums modulo 2^64 agree with sums modulo 2^56 in the low 56 bits,
+ * so a cleared KSV bit subtracts its row and column and the keys are masked only when they are read.
+*/
+class incremental_keyset
+{
+public:
+    /**
+     * @brief Constructs the keys of the first KSV.
+     * @param[in] key The packed Master Key Matrix.
+     * @param[in] ksv Key Selection Vector (KSV).
+    */
+    incremental_keyset(master_matrix const &key, std::bitset<40> const &ksv);
+
+    /**
+     * @brief Changes the KSV and updates the keys with the rows and columns of the changed bits only.
+     * @param[in] ksv The new Key Selection Vector (KSV).
+    */
+    void move_to(std::bitset<40> const &ksv);
+
+    /**
+     * @brief Clears one set KSV bit and sets one cleared KSV bit.
+     * @details Every key value changes by `+M[in] - M[out]`.
+     * @param[in] out Index of the set bit to clear.
+     * @param[in] in Index of the cleared bit to set.
+    */
+    void swap_bits(std::size_t out, std::size_t in);
+
+    /**
+     * @brief Returns the current Key Selection Vector (KSV).
+    */
+    std::bitset<40> ksv() const
+    {
+        return bits;
+    }
+
+    /**
+     * @brief Returns the source and sink HDCP keys of the current KSV.
+     * @param[out] result The source and sink HDCP keys.
+    */
+    void keyset(hdcp_keyset &result) const;
+
+private:
+    master_matrix const &key;
+    std::uint64_t bits;
+    hdcp_keyset sums;
+};
+
+/**
+ * @brief Walks every valid KSV (twenty '1's and twenty '0's) in revolving-door order.
+ * @details
+ *
+ * Consecutive KSVs in the revolving-door order (Knuth, TAOCP 7.2.1.3, Algorithm R) differ by
+ * one cleared and one set bit, so each step costs 40 additions and 40 subtractions per key
+ * instead of a full derivation. The walk starts at `0x00000fffff` and visits C(40, 20) KSVs.
+*/
+class revolving_door_sweep
+{
+public:
+    /**
+     * @brief Constructs the sweep positioned at the first KSV.
+     * @param[in] key The packed Master Key Matrix.
+    */
+    explicit revolving_door_sweep(master_matrix const &key);
+
+    /**
+     * @brief Moves to the next KSV.
+     * @return False if the current KSV is the last one.
+    */
+    bool next();
+
+    /**
+     * @brief Returns the current Key Selection Vector (KSV).
+    */
+    std::bitset<40> ksv() const
+    {
+        return keys.ksv();
+    }
+
+    /**
+     * @brief Returns the source and sink HDCP keys of the current KSV.
+     * @param[out] result The source and sink HDCP keys.
+    */
+    void keyset(hdcp_keyset &result) const
+    {
+        keys.keyset(result);
+    }
+
+private:
+    // Positions of the set bits, c[1] < c[2] < ... < c[20], and the sentinel c[21] = 40
+    std::array<std::size_t, 22> c;
+    incremental_keyset keys;
+};
+
+#endif // KEYSET_SWEEP_H
@@ -0,0 +1,128 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-binary.cpp
+ * @brief Defines the packed binary format of KSV lists.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "ksv-binary.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "ksv-set.h"
+
+bool is_ksv_binary(char const *data, std::size_t size)
+{
+    return size >= ksv_binary_magic.size() && std::equal(ksv_binary_magic.begin(), ksv_binary_magic.end(), data);
+}
+
+std::uint64_t ksv_binary_count(char const *header)
+{
+    unsigned char const *const p = reinterpret_cast<unsigned char const *>(header) + ksv_binary_magic.size();
+    std::uint64_t result         = 0;
+
+    for(int i = 7; i >= 0; i--)
+        result = (result << 8) | p[i];
+
+    return result;
+}
+
+bool check_ksv_binary(char const *data, std::size_t size, std::string const &name, std::uint64_t &count, std::string &error)
+{
+    if(size < ksv_binary_header_size)
+    {
+        error = name + ": truncated binary KSV list header.";
+        return false;
+    }
+
+    count = ksv_binary_count(data);
+
+    std::uint64_t const records = (size - ksv_binary_header_size) / ksv_binary_record_size;
+
+    if(records != count || (size - ksv_binary_header_size) % ksv_binary_record_size != 0)
+    {
+        error = name + ": the binary KSV list should hold " + std::to_string(count) + " KSVs, but its size is " + std::to_string(size) + " bytes.";
+        return false;
+    }
+
+    return true;
+}
+
+std::array<char, ksv_binary_header_size> ksv_binary_header(std::uint64_t count)
+{
+    std::array<char, ksv_binary_header_size> result = {};
+
+    std::copy(ksv_binary_magic.begin(), ksv_binary_magic.end(), result.begin());
+
+    for(std::size_t i = 0; i < 8; i++)
+        result[ksv_binary_magic.size() + i] = static_cast<char>((count >> (8 * i)) & 0xff);
+
+    return result;
+}
+
+bool convert_ksv_list(std::string const &input, std::string const &output, std::string &error)
+{
+    std::vector<std::uint64_t> ksvs;
+
+    if(!read_ksv_list(input, ksvs, error))
+        return false;
+
+    std::vector<char> data(ksv_binary_header_size + ksvs.size() * ksv_binary_record_size);
+
+    std::array<char, ksv_binary_header_size> const header = ksv_binary_header(ksvs.size());
+    std::copy(header.begin(), header.end(), data.begin());
+
+    for(std::size_t i = 0; i < ksvs.size(); i++)
+        store_ksv_record(ksvs[i], data.data() + ksv_binary_header_size + i * ksv_binary_record_size);
+
+    if(output == "-")
+    {
+        std::cout.write(data.data(), static_cast<std::streamsize>(data.size()));
+        std::cout.flush();
+
+        if(!std::cout)
+        {
+            error = "Cannot write the standard output.";
+            return false;
+        }
+
+        return true;
+    }
+
+    std::ofstream file(output, std::ios::binary);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    file.close();
+
+    if(!file)
+    {
+        error = "Cannot write '" + output + "'.";
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,128 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-binary.h
+ * @brief Defines the packed binary format of KSV lists.
+ * @details
+ *
+ * A binary KSV list is a 16-byte header followed by the KSVs:
+ *
+ * | Offset | Size  | Contents                                              |
+ * |--------|-------|-------------------------------------------------------|
+ * | 0      | 8     | Magic: `HDCPKSV` followed by the format version 0x01  |
+ * | 8      | 8     | Number of KSVs N, unsigned little-endian              |
+ * | 16     | 5 * N | The KSVs, 5 bytes each, unsigned little-endian        |
+ *
+ * The records are read straight from the memory-mapped file: no copy and no hexadecimal decoding.
+ *
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KSV_BINARY_H
+#define KSV_BINARY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Size of the header of a binary KSV list in bytes.
+*/
+constexpr std::size_t ksv_binary_header_size = 16;
+
+/**
+ * @brief Size of one KSV of a binary KSV list in bytes.
+*/
+constexpr std::size_t ksv_binary_record_size = 5;
+
+/**
+ * @brief The magic bytes at the beginning of a binary KSV list: `HDCPKSV` and the format version.
+*/
+constexpr std::array<char, 8> ksv_binary_magic = {'H', 'D', 'C', 'P', 'K', 'S', 'V', '\x01'};
+
+/**
+ * @brief Returns true if data starts with the magic bytes of a binary KSV list.
+ * @param[in] data The data.
+ * @param[in] size The size of `data` in bytes.
+*/
+bool is_ksv_binary(char const *data, std::size_t size);
+
+/**
+ * @brief Returns the number of KSVs of a binary KSV list.
+ * @param[in] header The 16-byte header.
+*/
+std::uint64_t ksv_binary_count(char const *header);
+
+/**
+ * @brief Checks that a binary KSV list holds as many KSVs as its header says.
+ * @param[in] data The list.
+ * @param[in] size The size of `data` in bytes.
+ * @param[in] name The list name, used in the error message.
+ * @param[out] count Receives the number of KSVs.
+ * @param[out] error Receives the error message on failure.
+ * @return True if the size of the list matches its header.
+ * @pre is_ksv_binary(data, size)
+*/
+bool check_ksv_binary(char const *data, std::size_t size, std::string const &name, std::uint64_t &count, std::string &error);
+
+/**
+ * @brief Returns the header of a binary KSV list.
+ * @param[in] count Number of KSVs.
+*/
+std::array<char, ksv_binary_header_size> ksv_binary_header(std::uint64_t count);
+
+/**
+ * @brief Reads one KSV of a binary KSV list.
+ * @param[in] record The 5-byte record.
+ * @return Key Selection Vector (KSV).
+*/
+inline std::uint64_t load_ksv_record(char const *record)
+{
+    unsigned char const *const p = reinterpret_cast<unsigned char const *>(record);
+
+    return std::uint64_t(p[0]) | (std::uint64_t(p[1]) << 8) | (std::uint64_t(p[2]) << 16) | (std::uint64_t(p[3]) << 24) | (std::uint64_t(p[4]) << 32);
+}
+
+/**
+ * @brief Writes one KSV of a binary KSV list.
+ * @param[in] ksv Key Selection Vector (KSV), 40 bits.
+ * @param[out] record The 5-byte record.
+*/
+inline void store_ksv_record(std::uint64_t ksv, char *record)
+{
+    for(std::size_t i = 0; i < ksv_binary_record_size; i++)
+        record[i] = static_cast<char>((ksv >> (8 * i)) & 0xff);
+}
+
+/**
+ * @brief Converts a text KSV list to a binary KSV list.
+ * @param[in] input The text list path (see read_ksv_list()), or `-` for the standard input.
+ * @param[in] output The binary list path, or `-` for the standard output.
+ * @param[out] error Receives the error message on failure.
+ * @return True on success.
+*/
+bool convert_ksv_list(std::string const &input, std::string const &output, std::string &error);
+
+#endif // KSV_BINARY_H
@@ -0,0 +1,134 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-generator.cpp
+ * @brief Defines a fast generator of random valid Key Selection Vectors.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "ksv-generator.h"
+
+#include <random>
+
+#include "ksv.h"
+
+// Known-answer tests of the Random123 reference implementation
+static_assert(philox4x32_10({0, 0, 0, 0}, {0, 0})[0] == 0x6627e8d5 && philox4x32_10({0, 0, 0, 0}, {0, 0})[3] == 0x9b00dbd8, "Philox4x32-10 test vector");
+static_assert(philox4x32_10({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff})[0] == 0x408f276d, "Philox4x32-10 test vector");
+static_assert(philox4x32_10({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0})[2] == 0x5001e420, "Philox4x32-10 test vector");
+
+namespace
+{
+    /**
+     * @brief Number of bits of a half of the Feistel network input.
+    */
+    constexpr unsigned half_bits = 19;
+
+    /**
+     * @brief A half of the Feistel network input.
+    */
+    constexpr std::uint64_t half_mask = (std::uint64_t(1) << half_bits) - 1;
+
+    static_assert(ksv_count <= (std::uint64_t(1) << (2 * half_bits)), "The Feistel network must cover every rank");
+    static_assert(ksv_count > (std::uint64_t(1) << (2 * half_bits - 1)), "Cycle walking needs the smallest covering domain");
+
+    /**
+     * @brief Returns the next value of a SplitMix64 sequence; used to expand a seed into the generator state.
+     * @param[in,out] x The SplitMix64 state.
+    */
+    std::uint64_t splitmix64(std::uint64_t &x)
+    {
+        std::uint64_t z = (x += 0x9e3779b97f4a7c15);
+        z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z               = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Returns 64 bits from `std::random_device`.
+    */
+    std::uint64_t random_seed()
+    {
+        std::random_device rd;
+        return (std::uint64_t(rd()) << 32) ^ rd();
+    }
+} // namespace
+
+ksv_generator::ksv_generator() : ksv_generator(random_seed())
+{
+}
+
+ksv_generator::ksv_generator(std::uint64_t seed) : state()
+{
+    // SplitMix64 never yields four zero values in a row, so the state is never all zeros
+    for(auto &s : state)
+        s = splitmix64(seed);
+}
+
+ksv_generator &ksv_generator::local()
+{
+    thread_local ksv_generator generator;
+    return generator;
+}
+
+ksv_permutation::ksv_permutation(std::uint64_t seed) : round_keys()
+{
+    for(auto &k : round_keys)
+        k = splitmix64(seed);
+}
+
+std::uint64_t ksv_permutation::encrypt(std::uint64_t x) const
+{
+    std::uint64_t left  = x >> half_bits;
+    std::uint64_t right = x & half_mask;
+
+    for(std::uint64_t const k : round_keys)
+    {
+        // Round function: a multiply-xorshift hash of the right half and the round key
+        std::uint64_t f = (right + k) * 0xbf58476d1ce4e5b9;
+        f ^= f >> 31;
+        f *= 0x94d049bb133111eb;
+
+        std::uint64_t const next = left ^ (f >> (64 - half_bits));
+        left                     = right;
+        right                    = next;
+    }
+
+    return (left << half_bits) | right;
+}
+
+std::uint64_t ksv_permutation::rank(std::uint64_t index) const
+{
+    std::uint64_t result = encrypt(index);
+
+    while(result >= ksv_count)
+        result = encrypt(result);
+
+    return result;
+}
+
+std::uint64_t ksv_permutation::operator()(std::uint64_t index) const
+{
+    return ksv_unrank(rank(index)).to_ullong();
+}
@@ -0,0 +1,258 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-generator.h
+ * @brief Defines a fast generator of random valid Key Selection Vectors.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KSV_GENERATOR_H
+#define KSV_GENERATOR_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Generates uniformly distributed random valid KSVs.
+ * @details
+ *
+ * The state is a xoshiro256** generator (256 bits, period 2^256 - 1), seeded once.
+ * A KSV is drawn by rejection: a uniform 40-bit value is accepted when it has exactly twenty '1's.
+ * Every valid KSV is then equally likely; about 8 values are drawn per KSV (C(40, 20) / 2^40 is about 1/8),
+ * which is several times faster than unranking a uniform rank.
+ *
+ * Nothing is allocated and no system call is made after construction.
+ * A generator must not be shared between threads; local() returns one per thread.
+*/
+class ksv_generator
+{
+public:
+    /**
+     * @brief Constructs a generator seeded from `std::random_device`.
+    */
+    ksv_generator();
+
+    /**
+     * @brief Constructs a generator from a seed.
+     * @param[in] seed The seed. Equal seeds produce equal sequences.
+    */
+    explicit ksv_generator(std::uint64_t seed);
+
+    /**
+     * @brief Returns a uniformly distributed random 64-bit value.
+    */
+    std::uint64_t next_u64()
+    {
+        std::uint64_t const result = rotl(state[1] * 5, 7) * 9;
+        std::uint64_t const t      = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief Returns a uniformly distributed random valid KSV.
+     * @return Key Selection Vector (KSV), 40 bits with exactly twenty '1's.
+    */
+    std::uint64_t operator()()
+    {
+        while(true)
+        {
+            std::uint64_t const candidate = next_u64() >> 24;
+
+            if(popcount40(candidate) == 20)
+                return candidate;
+        }
+    }
+
+    /**
+     * @brief Returns the generator of the calling thread.
+     * @note It is seeded from `std::random_device` on the first call in every thread.
+    */
+    static ksv_generator &local();
+
+    /**
+     * @brief Returns the number of '1's in a 64-bit value.
+     * @param[in] x The value.
+    */
+    static unsigned popcount40(std::uint64_t x)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(x));
+#else
+        x = x - ((x >> 1) & 0x5555555555555555);
+        x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0f;
+        return static_cast<unsigned>((x * 0x0101010101010101) >> 56);
+#endif
+    }
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::array<std::uint64_t, 4> state;
+};
+
+/**
+ * @brief The Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3").
+ * @details
+ *
+ * Maps a 128-bit counter and a 64-bit key to 128 random bits with ten rounds of multiplications and key bumps.
+ * There is no state: equal (counter, key) pairs always give equal results.
+ *
+ * @param[in] counter The counter.
+ * @param[in] key The key.
+ * @return 128 random bits.
+*/
+constexpr std::array<std::uint32_t, 4> philox4x32_10(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key)
+{
+    for(int round = 0; round < 10; round++)
+    {
+        if(round != 0)
+        {
+            key[0] += 0x9e3779b9;
+            key[1] += 0xbb67ae85;
+        }
+
+        std::uint64_t const p0 = std::uint64_t(0xd2511f53) * counter[0];
+        std::uint64_t const p1 = std::uint64_t(0xcd9e8d57) * counter[2];
+
+        counter = {std::uint32_t(p1 >> 32) ^ counter[1] ^ key[0], std::uint32_t(p1), std::uint32_t(p0 >> 32) ^ counter[3] ^ key[1], std::uint32_t(p0)};
+    }
+
+    return counter;
+}
+
+/**
+ * @brief Generates reproducible random valid KSVs: the KSV of an index is a pure function of the seed and the index.
+ * @details
+ *
+ * The KSV of index `i` is drawn by rejection from Philox4x32-10 blocks with the counter `(i, draw, attempt)`
+ * and the seed as the key; every block gives three 40-bit candidates.
+ * Nothing depends on the order of the calls, so any thread can compute any index
+ * and the output of a parallel run does not depend on the number of threads.
+ *
+ * `draw` selects an independent KSV for the same index, e.g. to replace a rejected one.
+*/
+class seeded_ksv_generator
+{
+public:
+    /**
+     * @brief Constructs a generator from a seed.
+     * @param[in] seed The seed.
+    */
+    explicit seeded_ksv_generator(std::uint64_t seed) : key({std::uint32_t(seed), std::uint32_t(seed >> 32)})
+    {
+    }
+
+    /**
+     * @brief Returns the KSV of an index.
+     * @param[in] index The index.
+     * @param[in] draw The draw for the index.
+     * @return Key Selection Vector (KSV), 40 bits with exactly twenty '1's.
+    */
+    std::uint64_t operator()(std::uint64_t index, std::uint32_t draw = 0) const
+    {
+        for(std::uint32_t attempt = 0;; attempt++)
+        {
+            std::array<std::uint32_t, 4> const r = philox4x32_10({std::uint32_t(index), std::uint32_t(index >> 32), draw, attempt}, key);
+
+            std::uint64_t const low  = r[0] | (std::uint64_t(r[1]) << 32);
+            std::uint64_t const high = r[2] | (std::uint64_t(r[3]) << 32);
+
+            std::uint64_t const candidates[3] = {
+                low & 0xffffffffff,
+                ((low >> 40) | (high << 24)) & 0xffffffffff,
+                (high >> 16) & 0xffffffffff,
+            };
+
+            for(std::uint64_t const candidate : candidates)
+            {
+                if(ksv_generator::popcount40(candidate) == 20)
+                    return candidate;
+            }
+        }
+    }
+
+private:
+    std::array<std::uint32_t, 2> key;
+};
+
+/**
+ * @brief A keyed random permutation of the valid KSVs: samples KSVs without replacement in O(1) memory.
+ * @details
+ *
+ * Index `i` is mapped to a rank by an 8-round balanced Feistel network over 38 bits (two 19-bit halves),
+ * which is a bijection of [0, 2^38). Since C(40, 20) is a little more than 2^37, the network is applied again
+ * while the result is not a valid rank (cycle walking, about 2 applications on average).
+ * The restriction to [0, C(40, 20)) is then a bijection too, so distinct indices give distinct KSVs.
+ *
+ * The KSV of an index depends only on the seed and the index: consecutive index ranges can be generated
+ * by different threads or processes and never overlap.
+*/
+class ksv_permutation
+{
+public:
+    /**
+     * @brief Constructs the permutation of a seed.
+     * @param[in] seed The seed.
+    */
+    explicit ksv_permutation(std::uint64_t seed);
+
+    /**
+     * @brief Returns the rank of an index.
+     * @param[in] index The index.
+     * @return The rank in [0, ksv_count).
+     * @pre `index` is less than `ksv_count`.
+    */
+    std::uint64_t rank(std::uint64_t index) const;
+
+    /**
+     * @brief Returns the KSV of an index.
+     * @param[in] index The index.
+     * @return Key Selection Vector (KSV), 40 bits with exactly twenty '1's.
+     * @pre `index` is less than `ksv_count`.
+    */
+    std::uint64_t operator()(std::uint64_t index) const;
+
+private:
+    /**
+     * @brief Applies the Feistel network to a 38-bit value.
+     * @param[in] x The value.
+    */
+    std::uint64_t encrypt(std::uint64_t x) const;
+
+    std::array<std::uint64_t, 8> round_keys;
+};
+
+#endif // KSV_GENERATOR_H
@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-parse.cpp
+ * @brief Defines the validating hexadecimal parser of Key Selection Vectors.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "ksv-parse.h"
+
+#include <cstring>
+
+namespace
+{
+    /**
+     * @brief Repeats a byte in every byte of a 64-bit value.
+     * @param[in] b The byte.
+    */
+    constexpr std::uint64_t bytes(std::uint8_t b)
+    {
+        return std::uint64_t(b) * 0x0101010101010101;
+    }
+
+    /**
+     * @brief Decodes 8 hexadecimal characters (the first one in the lowest byte).
+     * @param[in] w The characters.
+     * @param[out] invalid Receives 0x80 in every byte that is not a hexadecimal digit.
+     * @return The 32-bit number, the first character is the most significant digit.
+    */
+    std::uint32_t decode8(std::uint64_t w, std::uint64_t &invalid)
+    {
+        std::uint64_t const high  = w & bytes(0x80);
+        std::uint64_t const ascii = w & ~high; // Below 0x80, so adding up to 0x80 never carries out of a byte
+        std::uint64_t const lower = ascii | bytes(0x20);
+
+        // 0x80 in a byte if it is in ['0', '9'] or in ['a', 'f'] after case folding
+        std::uint64_t const digit = (ascii + bytes(0x80 - '0')) & ~(ascii + bytes(0x80 - '9' - 1));
+        std::uint64_t const alpha = (lower + bytes(0x80 - 'a')) & ~(lower + bytes(0x80 - 'f' - 1));
+
+        invalid = (~(digit | alpha) | high) & bytes(0x80);
+
+        // '0'-'9' -> 0-9, 'a'-'f' and 'A'-'F' -> 1-6 + 9
+        std::uint64_t v = (ascii & bytes(0x0f)) + ((alpha & bytes(0x80)) >> 7) * 9;
+
+        // Pack the nibbles: byte pairs, then 16-bit pairs, then 32-bit pairs
+        v = ((v & 0x000f000f000f000f) << 4) | ((v & 0x0f000f000f000f00) >> 8);
+        v = ((v & 0x000000ff000000ff) << 8) | ((v & 0x00ff000000ff0000) >> 16);
+        v = ((v & 0x000000000000ffff) << 16) | ((v & 0x0000ffff00000000) >> 32);
+
+        return static_cast<std::uint32_t>(v);
+    }
+
+    /**
+     * @brief Loads 8 bytes in little-endian order.
+     * @param[in] p The bytes.
+    */
+    std::uint64_t load_le64(unsigned char const *p)
+    {
+        std::uint64_t result = 0;
+
+        for(int i = 7; i >= 0; i--)
+            result = (result << 8) | p[i];
+
+        return result;
+    }
+} // namespace
+
+hex_parse_result parse_hex(std::string_view s, std::size_t max_digits)
+{
+    std::size_t const prefix = (s.size() >= 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) ? 2 : 0;
+    std::size_t const digits = s.size() - prefix;
+
+    if(digits == 0)
+        return {0, HEX_PARSE_EMPTY, 0};
+
+    if(digits > max_digits)
+        return {0, HEX_PARSE_TOO_LONG, 0};
+
+    // Right-align the digits in 16 characters, padded with '0'
+    unsigned char buffer[16];
+    std::memset(buffer, '0', sizeof(buffer));
+    std::memcpy(buffer + 16 - digits, s.data() + prefix, digits);
+
+    std::uint64_t invalid_high = 0;
+    std::uint64_t invalid_low  = 0;
+
+    std::uint64_t const high = decode8(load_le64(buffer), invalid_high);
+    std::uint64_t const low  = decode8(load_le64(buffer + 8), invalid_low);
+
+    if((invalid_high | invalid_low) != 0)
+    {
+        std::size_t index = 0;
+        while(((index < 8 ? invalid_high >> (index * 8) : invalid_low >> ((index - 8) * 8)) & 0x80) == 0)
+            index++;
+
+        return {0, HEX_PARSE_INVALID_DIGIT, index - (16 - digits) + prefix};
+    }
+
+    return {(high << 32) | low, HEX_PARSE_OK, 0};
+}
+
+std::size_t parse_ksvs(std::string_view const *inputs, std::size_t count, std::uint64_t *ksvs, hex_parse_result &error)
+{
+    for(std::size_t i = 0; i < count; i++)
+    {
+        hex_parse_result const result = parse_ksv(inputs[i]);
+
+        if(!result)
+        {
+            error = result;
+            return i;
+        }
+
+        ksvs[i] = result.value;
+    }
+
+    error = {0, HEX_PARSE_OK, 0};
+    return count;
+}
+
+std::string_view ksv_line_text(std::string_view line)
+{
+    std::size_t const first = line.find_first_not_of(" \t\r");
+    if(first == std::string_view::npos || line[first] == '#')
+        return std::string_view();
+
+    std::size_t const last = line.find_last_not_of(" \t\r");
+    return line.substr(first, last + 1 - first);
+}
+
+std::vector<std::size_t> line_blocks(char const *data, std::size_t size, std::size_t block_bytes)
+{
+    std::vector<std::size_t> bounds(1, 0);
+
+    while(bounds.back() < size)
+    {
+        std::size_t const target = bounds.back() + block_bytes;
+
+        if(target >= size)
+        {
+            bounds.push_back(size);
+            break;
+        }
+
+        void const *const newline = std::memchr(data + target, '\n', size - target);
+        bounds.push_back(newline ? static_cast<std::size_t>(static_cast<char const *>(newline) - data) + 1 : size);
+    }
+
+    return bounds;
+}
+
+std::string ksv_parse_error_message(std::string_view s, hex_parse_result const &result)
+{
+    std::string message = "'" + std::string(s) + "' is not a KSV: ";
+
+    switch(result.error)
+    {
+        case HEX_PARSE_OK:
+            return std::string();
+        case HEX_PARSE_EMPTY:
+            return message + "no hexadecimal digits.";
+        case HEX_PARSE_TOO_LONG:
+            return message + "more than 10 hexadecimal digits.";
+        case HEX_PARSE_INVALID_DIGIT:
+            return message + "invalid hexadecimal digit '" + s[result.position] + "' at position " + std::to_string(result.position + 1) + ".";
+    }
+
+    return message;
+}
@@ -0,0 +1,142 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-parse.h
+ * @brief Defines the validating hexadecimal parser of Key Selection Vectors.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KSV_PARSE_H
+#define KSV_PARSE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief The reason why a string is not a hexadecimal number.
+*/
+enum hex_parse_error
+{
+    HEX_PARSE_OK,
+    HEX_PARSE_EMPTY,         // No digits (an empty string or a lone `0x`)
+    HEX_PARSE_TOO_LONG,      // More digits than the number can hold
+    HEX_PARSE_INVALID_DIGIT, // A character that is not a hexadecimal digit
+};
+
+/**
+ * @brief The result of parsing a hexadecimal number.
+*/
+struct hex_parse_result
+{
+    /**
+     * @brief The number; 0 on error.
+    */
+    std::uint64_t value;
+
+    /**
+     * @brief The error.
+    */
+    hex_parse_error error;
+
+    /**
+     * @brief The offset of the invalid character in the string (`HEX_PARSE_INVALID_DIGIT` only).
+    */
+    std::size_t position;
+
+    /**
+     * @brief Returns true if the string is a valid number.
+    */
+    explicit operator bool() const
+    {
+        return error == HEX_PARSE_OK;
+    }
+};
+
+/**
+ * @brief Parses a hexadecimal number of up to 16 digits.
+ * @details
+ *
+ * Accepts `0`-`9`, `a`-`f` and `A`-`F` with an optional `0x` or `0X` prefix; nothing else, not even white space.
+ * The digits are decoded as two 8-byte words with SWAR (SIMD within a register) arithmetic:
+ * every byte is validated and converted without branches, then the nibbles are packed by shifts and masks.
+ *
+ * @param[in] s The string.
+ * @param[in] max_digits The maximal number of digits (1-16).
+ * @return The number or the error.
+*/
+hex_parse_result parse_hex(std::string_view s, std::size_t max_digits);
+
+/**
+ * @brief Parses a Key Selection Vector (KSV): 1 to 10 hexadecimal digits with an optional `0x` prefix.
+ * @param[in] s The string.
+ * @return The KSV (40 bits) or the error.
+ * @note The number of '1's is not checked.
+*/
+inline hex_parse_result parse_ksv(std::string_view s)
+{
+    return parse_hex(s, 10);
+}
+
+/**
+ * @brief Parses many Key Selection Vectors (KSVs).
+ * @param[in] inputs The strings.
+ * @param[in] count Number of strings.
+ * @param[out] ksvs Receives the KSVs.
+ * @param[out] error Receives the error of the first string that is not a KSV.
+ * @return The number of strings parsed before the first error; `count` if every string is a KSV.
+*/
+std::size_t parse_ksvs(std::string_view const *inputs, std::size_t count, std::uint64_t *ksvs, hex_parse_result &error);
+
+/**
+ * @brief Returns the KSV text of a line of a KSV list.
+ * @details
+ *
+ * KSV lists have one KSV per line. Surrounding white space is ignored, as are empty lines and lines starting with `#`.
+ *
+ * @param[in] line The line, without the new line character.
+ * @return The line without surrounding white space; empty for empty and comment lines.
+*/
+std::string_view ksv_line_text(std::string_view line);
+
+/**
+ * @brief Splits text into blocks of whole lines for parallel processing.
+ * @param[in] data The text.
+ * @param[in] size The size of `data` in bytes.
+ * @param[in] block_bytes The target block size in bytes.
+ * @return The block bounds: block `b` is `[bounds[b], bounds[b + 1])`; every block but the last one ends with a new line.
+*/
+std::vector<std::size_t> line_blocks(char const *data, std::size_t size, std::size_t block_bytes);
+
+/**
+ * @brief Describes a parse error.
+ * @param[in] s The string that was parsed.
+ * @param[in] result The parse result.
+ * @return A message, e.g. `'00000fffgf' is not a KSV: invalid hexadecimal digit 'g' at position 9.` (positions count from 1).
+*/
+std::string ksv_parse_error_message(std::string_view s, hex_parse_result const &result);
+
+#endif // KSV_PARSE_H
@@ -0,0 +1,165 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-set.cpp
+ * @brief Defines a compact set of KSVs for fast membership tests, e.g. of already issued or revoked KSVs.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "ksv-set.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include "ksv-binary.h"
+#include "ksv-parse.h"
+#include "mapped-file.h"
+
+namespace
+{
+    /**
+     * @brief A value that is never a KSV (KSVs have 40 bits); stored at the node 0.
+    */
+    constexpr std::uint64_t sentinel = ~std::uint64_t(0);
+
+    /**
+     * @brief Number of values in a 64-byte cache line.
+    */
+    constexpr std::size_t line_values = 8;
+
+    /**
+     * @brief Returns the offset of the first 64-byte aligned value of an array.
+     * @param[in] data The array.
+    */
+    std::size_t aligned_offset(std::uint64_t const *data)
+    {
+        std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(data);
+        return (line_values - (address / sizeof(std::uint64_t)) % line_values) % line_values;
+    }
+
+    /**
+     * @brief Fills the Eytzinger layout by an in-order traversal.
+     * @param[in] sorted The sorted values.
+     * @param[in,out] i The index of the next sorted value.
+     * @param[out] t The tree, node 1 is the root.
+     * @param[in] k The current node.
+     * @param[in] n Number of values.
+    */
+    void fill_tree(std::vector<std::uint64_t> const &sorted, std::size_t &i, std::uint64_t *t, std::size_t k, std::size_t n)
+    {
+        if(k > n)
+            return;
+
+        fill_tree(sorted, i, t, 2 * k, n);
+        t[k] = sorted[i++];
+        fill_tree(sorted, i, t, 2 * k + 1, n);
+    }
+} // namespace
+
+ksv_set::ksv_set() : ksv_set(std::vector<std::uint64_t>())
+{
+}
+
+ksv_set::ksv_set(std::vector<std::uint64_t> ksvs) : tree(), offset(0), count(0), filter(), filter_offset(0), blocks(0)
+{
+    std::sort(ksvs.begin(), ksvs.end());
+    ksvs.erase(std::unique(ksvs.begin(), ksvs.end()), ksvs.end());
+
+    count = ksvs.size();
+
+    // Node k is stored at tree[offset + k]; the offset aligns node 0 (and every node 8k) to a cache line
+    tree.assign(count + 1 + line_values, sentinel);
+    offset = aligned_offset(tree.data());
+
+    std::size_t i = 0;
+    fill_tree(ksvs, i, tree.data() + offset, 1, count);
+
+    // 16 bits per KSV, i.e. one 512-bit block per 32 KSVs
+    blocks = count / 32 + 1;
+    filter.assign(blocks * 8 + line_values, 0);
+    filter_offset = aligned_offset(filter.data());
+
+    for(std::uint64_t const ksv : ksvs)
+    {
+        std::uint64_t const h = hash(ksv);
+        std::uint64_t *block  = filter.data() + filter_offset + block_index(h) * 8;
+
+        for(std::size_t w = 0; w < 8; w++)
+            block[w] |= bit_mask(h, w);
+    }
+}
+
+bool read_ksv_list(std::string const &path, std::vector<std::uint64_t> &ksvs, std::string &error)
+{
+    mapped_file file;
+
+    if(!file.open(path, error))
+        return false;
+
+    if(is_ksv_binary(file.data(), file.size()))
+    {
+        std::uint64_t count = 0;
+
+        if(!check_ksv_binary(file.data(), file.size(), path, count, error))
+            return false;
+
+        char const *const records = file.data() + ksv_binary_header_size;
+
+        for(std::uint64_t i = 0; i < count; i++)
+            ksvs.push_back(load_ksv_record(records + i * ksv_binary_record_size));
+
+        return true;
+    }
+
+    char const *p             = file.data();
+    char const *const end     = p + file.size();
+    std::uint64_t line_number = 0;
+
+    while(p < end)
+    {
+        void const *const newline = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+        char const *const eol     = newline ? static_cast<char const *>(newline) : end;
+
+        std::string_view const text = ksv_line_text(std::string_view(p, static_cast<std::size_t>(eol - p)));
+
+        line_number++;
+        p = eol + 1;
+
+        if(text.empty())
+            continue;
+
+        hex_parse_result const result = parse_ksv(text);
+
+        if(!result)
+        {
+            error = path + ":" + std::to_string(line_number) + ": " + ksv_parse_error_message(text, result);
+            return false;
+        }
+
+        ksvs.push_back(result.value);
+    }
+
+    return true;
+}
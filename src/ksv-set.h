@@ -0,0 +1,197 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-set.h
+ * @brief Defines a compact set of KSVs for fast membership tests, e.g. of already issued or revoked KSVs.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KSV_SET_H
+#define KSV_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief An immutable set of KSVs: a blocked Bloom filter in front of a sorted array in Eytzinger layout.
+ * @details
+ *
+ * Most tested KSVs (fresh random ones) are not in the set. The blocked Bloom filter answers those with one
+ * cache line: the KSV is hashed to a 512-bit block and to one bit in each of its eight 64-bit words,
+ * and it may be in the set only if all eight bits are set. With 16 filter bits per KSV
+ * fewer than 0.1% of the other KSVs pass the filter.
+ *
+ * The exact answer comes from the sorted array in Eytzinger (breadth-first binary tree) layout. The node `k` has the children `2k` and `2k + 1`, so the top levels of the tree share a few cache lines
+ * and the 8 nodes three levels below `k` fill one cache line that is prefetched while the current levels are compared.
+ * The search is branch-free: every level is one comparison that selects the next node.
+ * The values are stored in 8 bytes each; the array and the filter are 64-byte aligned.
+*/
+class ksv_set
+{
+public:
+    /**
+     * @brief Constructs an empty set.
+    */
+    ksv_set();
+
+    /**
+     * @brief Constructs the set of the given KSVs.
+     * @param[in] ksvs The KSVs, in any order and possibly repeated.
+    */
+    explicit ksv_set(std::vector<std::uint64_t> ksvs);
+
+    /**
+     * @brief Returns the number of distinct KSVs in the set.
+    */
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * @brief Returns true if the set is empty.
+    */
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    /**
+     * @brief Returns true if the set contains a KSV.
+     * @param[in] ksv Key Selection Vector (KSV).
+    */
+    bool contains(std::uint64_t ksv) const
+    {
+        return may_contain(ksv) && tree_contains(ksv);
+    }
+
+private:
+    /**
+     * @brief Returns false if the set certainly does not contain a KSV (the blocked Bloom filter test).
+     * @param[in] ksv Key Selection Vector (KSV).
+    */
+    bool may_contain(std::uint64_t ksv) const
+    {
+        std::uint64_t const h      = hash(ksv);
+        std::uint64_t const *block = filter.data() + filter_offset + block_index(h) * 8;
+        std::uint64_t missing      = 0;
+
+        for(std::size_t w = 0; w < 8; w++)
+            missing |= ~block[w] & bit_mask(h, w);
+
+        return missing == 0;
+    }
+
+    /**
+     * @brief Returns true if the Eytzinger array contains a KSV.
+     * @param[in] ksv Key Selection Vector (KSV).
+    */
+    bool tree_contains(std::uint64_t ksv) const
+    {
+        std::uint64_t const *t = tree.data() + offset;
+        std::size_t k          = 1;
+
+        while(k <= count)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(t + k * 8);
+#endif
+            k = 2 * k + (t[k] < ksv);
+        }
+
+        // Undo the right turns taken after the last left turn; the node of the left turn is the lower bound.
+        // k = 0 (no lower bound) selects the sentinel, which is not a KSV.
+#if defined(__GNUC__) || defined(__clang__)
+        k >>= __builtin_ffsll(static_cast<long long>(~k));
+#else
+        while(k & 1)
+            k >>= 1;
+        k >>= 1;
+#endif
+
+        return t[k] == ksv;
+    }
+
+    /**
+     * @brief Mixes the bits of a KSV (the finalizer of MurmurHash3).
+     * @param[in] ksv Key Selection Vector (KSV).
+    */
+    static std::uint64_t hash(std::uint64_t ksv)
+    {
+        ksv ^= ksv >> 33;
+        ksv *= 0xff51afd7ed558ccd;
+        ksv ^= ksv >> 33;
+        ksv *= 0xc4ceb9fe1a85ec53;
+        return ksv ^ (ksv >> 33);
+    }
+
+    /**
+     * @brief Returns the filter block of a hash: the high 32 bits scaled to the number of blocks.
+     * @param[in] h The hash.
+    */
+    std::size_t block_index(std::uint64_t h) const
+    {
+        return static_cast<std::size_t>(((h >> 32) * blocks) >> 32);
+    }
+
+    /**
+     * @brief Returns the bit of a hash in the word `w` of its block, selected by the low 32 bits of the hash.
+     * @param[in] h The hash.
+     * @param[in] w The word (0-7).
+    */
+    static std::uint64_t bit_mask(std::uint64_t h, std::size_t w)
+    {
+        // Odd multipliers of the split block Bloom filter of Apache Parquet
+        static constexpr std::uint32_t salt[8] = {0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d, 0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
+
+        return std::uint64_t(1) << ((std::uint32_t(h) * salt[w]) >> 26);
+    }
+
+    std::vector<std::uint64_t> tree;
+    std::size_t offset;
+    std::size_t count;
+
+    std::vector<std::uint64_t> filter;
+    std::size_t filter_offset;
+    std::uint64_t blocks;
+};
+
+/**
+ * @brief Reads a list of KSVs from a file.
+ * @details
+ *
+ * The file has one KSV per line: 1 to 10 hexadecimal digits, with an optional `0x` prefix.
+ * Surrounding white space is ignored, as are empty lines and lines starting with `#`.
+ * The file is memory-mapped. A binary KSV list (see ksv-binary.h) is detected by its magic bytes and read as well.
+ *
+ * @param[in] path The file path, or `-` for the standard input.
+ * @param[out] ksvs Receives the KSVs in file order.
+ * @param[out] error Receives the error message on failure.
+ * @return True on success, false if the file cannot be read or a line is not a KSV.
+*/
+bool read_ksv_list(std::string const &path, std::vector<std::uint64_t> &ksvs, std::string &error);
+
+#endif // KSV_SET_H
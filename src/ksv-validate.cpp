@@ -0,0 +1,311 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-validate.cpp
+ * @brief Defines the validation of KSV lists.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "ksv-validate.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "cpu-features.h"
+#include "hex-encode.h"
+#include "ksv-binary.h"
+#include "ksv-parse.h"
+#include "mapped-file.h"
+#include "parallel.h"
+
+#ifdef HGK_X86_SIMD
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief Target size of one block of a text KSV list in bytes.
+    */
+    constexpr std::size_t bytes_per_block = 256 * 1024;
+
+    /**
+     * @brief Number of records in one block of a binary KSV list.
+    */
+    constexpr std::size_t records_per_block = 32 * 1024;
+
+    using check_weights_function = void (*)(std::uint64_t const *ksvs, std::size_t count, std::uint8_t *valid);
+
+    void check_weights_scalar(std::uint64_t const *ksvs, std::size_t count, std::uint8_t *valid)
+    {
+        for(std::size_t i = 0; i < count; i++)
+        {
+            // SWAR population count
+            std::uint64_t x = ksvs[i];
+            x               = x - ((x >> 1) & 0x5555555555555555);
+            x               = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+            x               = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0f;
+
+            valid[i] = ((x * 0x0101010101010101) >> 56) == 20;
+        }
+    }
+
+#ifdef HGK_X86_SIMD
+    __attribute__((target("avx2"))) void check_weights_avx2(std::uint64_t const *ksvs, std::size_t count, std::uint8_t *valid)
+    {
+        __m256i const table  = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        __m256i const low    = _mm256_set1_epi8(0x0f);
+        __m256i const twenty = _mm256_set1_epi64x(20);
+
+        std::size_t i = 0;
+
+        for(; i + 4 <= count; i += 4)
+        {
+            __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ksvs + i));
+
+            // Bit count of every byte from its two nibbles, then the byte counts summed per 64-bit lane
+            __m256i const bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(x, low)),
+                                                  _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+            __m256i const sums  = _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+
+            int const equal = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(sums, twenty)));
+
+            valid[i]     = equal & 1;
+            valid[i + 1] = (equal >> 1) & 1;
+            valid[i + 2] = (equal >> 2) & 1;
+            valid[i + 3] = (equal >> 3) & 1;
+        }
+
+        check_weights_scalar(ksvs + i, count - i, valid + i);
+    }
+#endif
+
+    check_weights_function select_check_weights()
+    {
+#ifdef HGK_X86_SIMD
+        if(cpu_has_avx2())
+            return check_weights_avx2;
+#endif
+
+        return check_weights_scalar;
+    }
+
+    /**
+     * @brief An invalid line.
+    */
+    struct invalid_line
+    {
+        /**
+         * @brief The line number inside its block, from 1.
+        */
+        std::uint64_t line;
+
+        /**
+         * @brief The diagnostic message.
+        */
+        std::string message;
+    };
+
+    /**
+     * @brief The validation result of one block.
+    */
+    struct validation_block
+    {
+        /**
+         * @brief The counts of the block.
+        */
+        ksv_validation counts;
+
+        /**
+         * @brief The invalid lines in line order.
+        */
+        std::vector<invalid_line> invalid;
+
+        /**
+         * @brief Scratch buffers: the parsed KSVs, their line numbers and their weight check results.
+        */
+        std::vector<std::uint64_t> ksvs;
+        std::vector<std::uint64_t> ksv_lines;
+        std::vector<std::uint8_t> valid;
+    };
+
+    /**
+     * @brief Checks the weight of the parsed KSVs of a block and records the invalid ones.
+     * @param[in,out] out The block.
+    */
+    void check_block_weights(validation_block &out)
+    {
+        out.valid.resize(out.ksvs.size());
+        check_ksv_weights(out.ksvs.data(), out.ksvs.size(), out.valid.data());
+
+        std::size_t const syntax_errors = out.invalid.size();
+
+        for(std::size_t i = 0; i < out.ksvs.size(); i++)
+        {
+            if(out.valid[i])
+                continue;
+
+            out.invalid.push_back({out.ksv_lines[i], ksv_weight_error_message(out.ksvs[i])});
+        }
+
+        out.counts.weight_errors = out.invalid.size() - syntax_errors;
+        out.counts.valid         = out.ksvs.size() - out.counts.weight_errors;
+
+        // Syntax and weight errors were collected separately
+        std::inplace_merge(out.invalid.begin(),
+                           out.invalid.begin() + static_cast<std::ptrdiff_t>(syntax_errors),
+                           out.invalid.end(),
+                           [](invalid_line const &a, invalid_line const &b)
+                           {
+                               return a.line < b.line;
+                           });
+    }
+} // namespace
+
+std::string ksv_weight_error_message(std::uint64_t ksv)
+{
+    std::string text(ksv_hex_digits, '0');
+    encode_hex<40>(ksv, text.data());
+
+    unsigned weight = 0;
+    for(std::uint64_t x = ksv; x != 0; x &= x - 1)
+        weight++;
+
+    return "'" + text + "' is not a valid KSV: it has " + std::to_string(weight) + " '1's instead of 20.";
+}
+
+void check_ksv_weights(std::uint64_t const *ksvs, std::size_t count, std::uint8_t *valid)
+{
+    static check_weights_function const check_weights = select_check_weights();
+    check_weights(ksvs, count, valid);
+}
+
+bool validate_ksv_list(std::string const &path, unsigned threads, std::ostream &os, ksv_validation &summary, std::string &error)
+{
+    mapped_file file;
+
+    if(!file.open(path, error))
+        return false;
+
+    std::string const name = path == "-" ? "<stdin>" : path;
+    summary                = ksv_validation();
+
+    bool const binary    = is_ksv_binary(file.data(), file.size());
+    std::uint64_t blocks = 0;
+    std::vector<std::size_t> bounds;
+    std::uint64_t records = 0;
+
+    if(binary)
+    {
+        if(!check_ksv_binary(file.data(), file.size(), name, records, error))
+            return false;
+
+        blocks = (records + records_per_block - 1) / records_per_block;
+    }
+    else
+    {
+        bounds = line_blocks(file.data(), file.size(), bytes_per_block);
+        blocks = bounds.size() - 1;
+    }
+
+    run_ordered<validation_block>(
+        blocks,
+        threads,
+        [&](std::uint64_t b, validation_block &out)
+        {
+            out.counts = ksv_validation();
+            out.invalid.clear();
+            out.ksvs.clear();
+            out.ksv_lines.clear();
+
+            if(binary)
+            {
+                std::uint64_t const first = b * records_per_block;
+                std::uint64_t const n     = std::min<std::uint64_t>(records_per_block, records - first);
+                char const *const data    = file.data() + ksv_binary_header_size + first * ksv_binary_record_size;
+
+                for(std::uint64_t i = 0; i < n; i++)
+                {
+                    out.ksvs.push_back(load_ksv_record(data + i * ksv_binary_record_size));
+                    out.ksv_lines.push_back(i + 1);
+                }
+
+                out.counts.lines = n;
+                out.counts.ksvs  = n;
+            }
+            else
+            {
+                char const *p         = file.data() + bounds[b];
+                char const *const end = file.data() + bounds[b + 1];
+
+                while(p < end)
+                {
+                    void const *const newline = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+                    char const *const eol     = newline ? static_cast<char const *>(newline) : end;
+
+                    std::string_view const text = ksv_line_text(std::string_view(p, static_cast<std::size_t>(eol - p)));
+
+                    out.counts.lines++;
+                    p = eol + 1;
+
+                    if(text.empty())
+                        continue;
+
+                    out.counts.ksvs++;
+
+                    hex_parse_result const parsed = parse_ksv(text);
+
+                    if(!parsed)
+                    {
+                        out.invalid.push_back({out.counts.lines, ksv_parse_error_message(text, parsed)});
+                        continue;
+                    }
+
+                    out.ksvs.push_back(parsed.value);
+                    out.ksv_lines.push_back(out.counts.lines);
+                }
+
+                out.counts.syntax_errors = out.invalid.size();
+            }
+
+            check_block_weights(out);
+        },
+        [&](validation_block &out)
+        {
+            for(auto const &x : out.invalid)
+                os << name << ':' << (summary.lines + x.line) << ": " << x.message << '\n';
+
+            summary.lines += out.counts.lines;
+            summary.ksvs += out.counts.ksvs;
+            summary.valid += out.counts.valid;
+            summary.syntax_errors += out.counts.syntax_errors;
+            summary.weight_errors += out.counts.weight_errors;
+
+            return true;
+        });
+
+    return true;
+}
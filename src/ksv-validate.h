@@ -0,0 +1,104 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv-validate.h
+ * @brief Defines the validation of KSV lists.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KSV_VALIDATE_H
+#define KSV_VALIDATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Summary counts of a KSV list validation.
+*/
+struct ksv_validation
+{
+    /**
+     * @brief Number of lines (text lists) or records (binary lists).
+    */
+    std::uint64_t lines = 0;
+
+    /**
+     * @brief Number of lines that are not empty or comments.
+    */
+    std::uint64_t ksvs = 0;
+
+    /**
+     * @brief Number of valid KSVs.
+    */
+    std::uint64_t valid = 0;
+
+    /**
+     * @brief Number of lines that are not hexadecimal KSVs.
+    */
+    std::uint64_t syntax_errors = 0;
+
+    /**
+     * @brief Number of KSVs that do not have exactly twenty '1's.
+    */
+    std::uint64_t weight_errors = 0;
+};
+
+/**
+ * @brief Marks the KSVs that have exactly twenty '1's.
+ * @details
+ *
+ * Uses a vectorized population count (AVX2 nibble lookup) when the running CPU supports it.
+ *
+ * @param[in] ksvs Key Selection Vectors (KSVs).
+ * @param[in] count Number of KSVs.
+ * @param[out] valid Receives 1 for every KSV with twenty '1's, 0 for the others.
+*/
+void check_ksv_weights(std::uint64_t const *ksvs, std::size_t count, std::uint8_t *valid);
+
+/**
+ * @brief Returns the message for a KSV that does not have exactly twenty '1's.
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @return E.g. "'00000aaaa0' is not a valid KSV: it has 8 '1's instead of 20."
+*/
+std::string ksv_weight_error_message(std::uint64_t ksv);
+
+/**
+ * @brief Validates a KSV list: the syntax of every line and the number of '1's of every KSV.
+ * @details
+ *
+ * The list is read as by listed_keysets() (text or binary, memory-mapped, `-` for the standard input)
+ * and checked by worker threads. Every invalid line is reported in line order as `<name>:<line>: <message>`.
+ *
+ * @param[in] path The file path, or `-` for the standard input.
+ * @param[in] threads Number of worker threads.
+ * @param[out] os Receives the diagnostics.
+ * @param[out] summary Receives the counts.
+ * @param[out] error Receives the error message if the list cannot be read.
+ * @return True if the list was read (valid or not), false on a read error.
+*/
+bool validate_ksv_list(std::string const &path, unsigned threads, std::ostream &os, ksv_validation &summary, std::string &error);
+
+#endif // KSV_VALIDATE_H
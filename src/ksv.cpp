@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv.cpp
+ * @brief Defines the valid-KSV space: ranking and unranking of Key Selection Vectors.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "ksv.h"
+
+#include <array>
+
+namespace
+{
+    /**
+     * @brief Binomial coefficients C(n, k) for 0 <= n <= 40 and 0 <= k <= 20.
+    */
+    using binomial_table = std::array<std::array<std::uint64_t, 21>, 41>;
+
+    constexpr binomial_table make_binomial_table()
+    {
+        binomial_table result = {};
+
+        for(std::size_t n = 0; n <= 40; n++)
+        {
+            result[n][0] = 1;
+
+            for(std::size_t k = 1; k <= 20 && k <= n; k++)
+                result[n][k] = result[n - 1][k - 1] + (k < n ? result[n - 1][k] : 0);
+        }
+
+        return result;
+    }
+
+    constexpr binomial_table binomial = make_binomial_table();
+
+    static_assert(binomial[40][20] == ksv_count, "C(40, 20) must be equal to ksv_count");
+} // namespace
+
+std::uint64_t ksv_rank(std::bitset<40> const &ksv)
+{
+    std::uint64_t const bits = ksv.to_ullong();
+    std::uint64_t result     = 0;
+    std::size_t k            = 0;
+
+    for(std::size_t c = 0; c < 40 && k < 20; c++)
+    {
+        if((bits >> c) & 1)
+        {
+            k++;
+            result += binomial[c][k];
+        }
+    }
+
+    return result;
+}
+
+std::bitset<40> ksv_unrank(std::uint64_t rank)
+{
+    std::uint64_t result = 0;
+    std::size_t c        = 40;
+
+    // Greedy: the largest c[k] with C(c[k], k) <= rank, for k = 20 down to 1
+    for(std::size_t k = 20; k > 0; k--)
+    {
+        do
+        {
+            c--;
+        } while(binomial[c][k] > rank);
+
+        rank -= binomial[c][k];
+        result |= std::uint64_t(1) << c;
+    }
+
+    return result;
+}
+
+std::bitset<40> ksv_next(std::bitset<40> const &ksv)
+{
+    // Gosper's hack: move the lowest movable '1' one position up and the '1's below it to the bottom
+    std::uint64_t const bits   = ksv.to_ullong();
+    std::uint64_t const lowest = bits & (~bits + 1);
+    std::uint64_t const ripple = bits + lowest;
+
+    return ripple | (((bits ^ ripple) >> 2) / lowest);
+}
@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ksv.h
+ * @brief Defines the valid-KSV space: ranking and unranking of Key Selection Vectors.
+ * @details
+ *
+ * A valid KSV has twenty '1's and twenty '0's, so there are C(40, 20) = 137846528820 of them.
+ * The combinatorial number system maps every valid KSV to a dense index (rank) in [0, C(40, 20)):
+ * the rank of a KSV with set bits c[1] < c[2] < ... < c[20] is C(c[1], 1) + C(c[2], 2) + ... + C(c[20], 20).
+ * Ranks follow the numeric order of the KSVs, so rank 0 is `0x00000fffff` and the last rank is `0xfffff00000`.
+ *
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef KSV_H
+#define KSV_H
+
+#include <bitset>
+#include <cstdint>
+
+/**
+ * @brief Number of valid KSVs, C(40, 20).
+*/
+constexpr std::uint64_t ksv_count = 137846528820;
+
+/**
+ * @brief Returns the rank of a valid KSV.
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @return The rank in [0, ksv_count).
+ * @pre `ksv` has exactly twenty '1's.
+*/
+std::uint64_t ksv_rank(std::bitset<40> const &ksv);
+
+/**
+ * @brief Returns the valid KSV of a rank.
+ * @param[in] rank The rank.
+ * @return Key Selection Vector (KSV).
+ * @pre `rank` is less than `ksv_count`.
+*/
+std::bitset<40> ksv_unrank(std::uint64_t rank);
+
+/**
+ * @brief Returns the valid KSV of the next rank.
+ * @param[in] ksv Key Selection Vector (KSV).
+ * @return The smallest KSV with twenty '1's that is greater than `ksv`.
+ * @pre `ksv` has exactly twenty '1's and is not `0xfffff00000`.
+*/
+std::bitset<40> ksv_next(std::bitset<40> const &ksv);
+
+#endif // KSV_H
@@ -0,0 +1,142 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file mapped-file.cpp
+ * @brief Defines a read-only memory-mapped file.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "mapped-file.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define HGK_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+mapped_file::~mapped_file()
+{
+    close();
+}
+
+void mapped_file::close()
+{
+#ifdef HGK_MMAP
+    if(mapped)
+        munmap(const_cast<char *>(address), length);
+#endif
+
+    address = nullptr;
+    length  = 0;
+    mapped  = false;
+    contents.clear();
+}
+
+bool mapped_file::open(std::string const &path, std::string &error)
+{
+    close();
+
+    if(path == "-")
+    {
+        contents.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+
+        if(std::cin.bad())
+        {
+            error = "Cannot read the standard input.";
+            return false;
+        }
+
+        address = contents.data();
+        length  = contents.size();
+        return true;
+    }
+
+#ifdef HGK_MMAP
+    int const fd = ::open(path.c_str(), O_RDONLY);
+
+    if(fd < 0)
+    {
+        error = "Cannot open '" + path + "'.";
+        return false;
+    }
+
+    struct stat st;
+
+    if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+    {
+        length = static_cast<std::size_t>(st.st_size);
+
+        if(length == 0)
+        {
+            ::close(fd);
+            return true;
+        }
+
+        void *const p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if(p == MAP_FAILED)
+        {
+            length = 0;
+            error  = "Cannot map '" + path + "'.";
+            return false;
+        }
+
+        madvise(p, length, MADV_SEQUENTIAL);
+
+        address = static_cast<char const *>(p);
+        mapped  = true;
+        return true;
+    }
+
+    // Not a regular file (e.g. a pipe): read it
+    ::close(fd);
+#endif
+
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+    {
+        error = "Cannot open '" + path + "'.";
+        return false;
+    }
+
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    if(file.bad())
+    {
+        error = "Cannot read '" + path + "'.";
+        return false;
+    }
+
+    address = contents.data();
+    length  = contents.size();
+    return true;
+}
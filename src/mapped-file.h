@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file mapped-file.h
+ * @brief Defines a read-only memory-mapped file.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A file mapped into memory for reading; unmapped by the destructor.
+ * @details
+ *
+ * On POSIX systems the file is mapped with `mmap()` and the kernel is told that it is read sequentially,
+ * so pages are read ahead and nothing is copied. Elsewhere the file is read into memory,
+ * as is the standard input (`-`).
+*/
+class mapped_file
+{
+public:
+    mapped_file() = default;
+    ~mapped_file();
+
+    mapped_file(mapped_file const &)            = delete;
+    mapped_file &operator=(mapped_file const &) = delete;
+
+    /**
+     * @brief Maps a file.
+     * @param[in] path The file path, or `-` for the standard input.
+     * @param[out] error Receives the error message on failure.
+     * @return True on success.
+    */
+    bool open(std::string const &path, std::string &error);
+
+    /**
+     * @brief Returns the contents of the file.
+    */
+    char const *data() const
+    {
+        return address;
+    }
+
+    /**
+     * @brief Returns the size of the file in bytes.
+    */
+    std::size_t size() const
+    {
+        return length;
+    }
+
+private:
+    /**
+     * @brief Unmaps the file.
+    */
+    void close();
+
+    char const *address = nullptr;
+    std::size_t length  = 0;
+    bool mapped         = false;
+    std::vector<char> contents; // Used when the file cannot be mapped
+};
+
+#endif // MAPPED_FILE_H
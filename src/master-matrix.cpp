@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file master-matrix.cpp
+ * @brief Defines the packed Master Key Matrix used by the fast HDCP key derivation paths.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "master-matrix.h"
+
+master_matrix::master_matrix(std::array<std::bitset<56>, 1600> const &key)
+{
+    for(std::size_t z = 0; z < 40; z++)
+    {
+        for(std::size_t i = 0; i < 40; i++)
+        {
+            rows[z * 40 + i]    = key[z * 40 + i].to_ullong();
+            columns[z * 40 + i] = key[i * 40 + z].to_ullong();
+        }
+    }
+
+    compute_totals();
+}
@@ -0,0 +1,169 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file master-matrix.h
+ * @brief Defines the packed Master Key Matrix used by the fast HDCP key derivation paths.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef MASTER_MATRIX_H
+#define MASTER_MATRIX_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+/**
+ * @brief The Master Key Matrix (HDCP versions 1.0-1.4) packed into 64-bit values.
+ * @details
+ *
+ * The source key value `i` is the sum of `key[z * 40 + i]` and the sink key value `i` is the sum of `key[i * 40 + z]`
+ * over every set KSV bit `z`.
+ *
+ * The matrix is stored twice: row-major (the original layout) and column-major (transposed).
+ * Both derivations then add whole 40-value rows that are contiguous in memory.
+ * Each row is 320 bytes, so with 64-byte alignment every row starts on a cache line.
+ *
+ * The sums of all 40 rows and of all 40 columns (the keys of the all-ones KSV) are kept as well:
+ * the keys of the complement `~ksv` are `total[i] - key(ksv)[i]` modulo 2^56.
+ *
+ * A matrix built from constant values is a literal: it can be `constexpr`, is placed in read-only data
+ * and derivations from it can be evaluated at compile time.
+*/
+class master_matrix
+{
+public:
+    /**
+     * @brief Constructs a packed copy of the Master Key Matrix.
+     * @param[in] key The Master Key Matrix.
+    */
+    explicit master_matrix(std::array<std::bitset<56>, 1600> const &key);
+
+    /**
+     * @brief Constructs the Master Key Matrix from 56-bit values in the original (row-major) layout.
+     * @param[in] key The Master Key Matrix.
+    */
+    explicit constexpr master_matrix(std::array<std::uint64_t, 1600> const &key) : rows(key), columns(), source_totals(), sink_totals()
+    {
+        for(std::size_t z = 0; z < 40; z++)
+        {
+            for(std::size_t i = 0; i < 40; i++)
+                columns[z * 40 + i] = key[i * 40 + z];
+        }
+
+        compute_totals();
+    }
+
+    /**
+     * @brief Returns the 40 values that are added to the source key when KSV bit `z` is set.
+     * @param[in] z KSV bit index (0-39).
+    */
+    constexpr std::uint64_t const *row(std::size_t z) const
+    {
+        return rows.data() + z * 40;
+    }
+
+    /**
+     * @brief Returns the 40 values that are added to the sink key when KSV bit `z` is set.
+     * @param[in] z KSV bit index (0-39).
+    */
+    constexpr std::uint64_t const *column(std::size_t z) const
+    {
+        return columns.data() + z * 40;
+    }
+
+    /**
+     * @brief Returns the matrix in the original (row-major) layout.
+    */
+    constexpr std::array<std::uint64_t, 1600> const &row_major() const
+    {
+        return rows;
+    }
+
+    /**
+     * @brief Returns the transposed (column-major) matrix.
+    */
+    constexpr std::array<std::uint64_t, 1600> const &column_major() const
+    {
+        return columns;
+    }
+
+    /**
+     * @brief Returns the sum of all rows modulo 2^56: the source key of the all-ones KSV.
+    */
+    constexpr std::array<std::uint64_t, 40> const &source_total() const
+    {
+        return source_totals;
+    }
+
+    /**
+     * @brief Returns the sum of all columns modulo 2^56: the sink key of the all-ones KSV.
+    */
+    constexpr std::array<std::uint64_t, 40> const &sink_total() const
+    {
+        return sink_totals;
+    }
+
+    /**
+     * @brief Returns the matrix in the original (row-major) layout as `std::bitset` values.
+    */
+    constexpr std::array<std::bitset<56>, 1600> to_bitsets() const
+    {
+        std::array<std::bitset<56>, 1600> result = {};
+
+        for(std::size_t i = 0; i < 1600; i++)
+            result[i] = rows[i];
+
+        return result;
+    }
+
+private:
+    /**
+     * @brief Computes `source_totals` and `sink_totals` from `rows` and `columns`.
+    */
+    constexpr void compute_totals()
+    {
+        for(std::size_t i = 0; i < 40; i++)
+        {
+            std::uint64_t source = 0;
+            std::uint64_t sink   = 0;
+
+            for(std::size_t z = 0; z < 40; z++)
+            {
+                source += rows[z * 40 + i];
+                sink += columns[z * 40 + i];
+            }
+
+            source_totals[i] = source & 0xffffffffffffff;
+            sink_totals[i]   = sink & 0xffffffffffffff;
+        }
+    }
+
+    alignas(64) std::array<std::uint64_t, 1600> rows;
+    alignas(64) std::array<std::uint64_t, 1600> columns;
+    alignas(64) std::array<std::uint64_t, 40> source_totals;
+    alignas(64) std::array<std::uint64_t, 40> sink_totals;
+};
+
+#endif // MASTER_MATRIX_H
@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file nibble-table.cpp
+ * @brief Defines table-driven HDCP key derivation from per-nibble partial sums.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#include "nibble-table.h"
+
+#include "cpu-features.h"
+#include "intel-hdcp-key.h"
+
+#ifdef HGK_X86_SIMD
+    #include <immintrin.h>
+#endif
+
+constexpr nibble_table intel_nibble_table(intel_master_matrix);
+
+namespace
+{
+    /**
+     * @brief Sums the 10 selected 80-value table entries and masks the sums to 56 bits.
+     * @param[in] entries The selected entries.
+     * @param[out] result The source and sink HDCP keys.
+    */
+    using sum_entries_function = void (*)(std::uint64_t const *const (&entries)[10], hdcp_keyset &result);
+
+    void sum_entries_scalar(std::uint64_t const *const (&entries)[10], hdcp_keyset &result)
+    {
+        std::array<std::uint64_t, 80> acc = {};
+
+        for(std::size_t p = 0; p < 10; p++)
+        {
+            for(std::size_t i = 0; i < 80; i++)
+                acc[i] += entries[p][i];
+        }
+
+        for(std::size_t i = 0; i < 40; i++)
+        {
+            result.source[i] = acc[i] & 0xffffffffffffff;
+            result.sink[i]   = acc[40 + i] & 0xffffffffffffff;
+        }
+    }
+
+#ifdef HGK_X86_SIMD
+    __attribute__((target("avx2"))) void sum_entries_avx2(std::uint64_t const *const (&entries)[10], hdcp_keyset &result)
+    {
+        __m256i const mask = _mm256_set1_epi64x(0xffffffffffffff);
+
+        // 20 accumulators do not fit into 16 ymm registers, so the source and sink halves are summed separately
+        for(std::size_t half = 0; half < 2; half++)
+        {
+            __m256i acc[10];
+            for(auto &x : acc)
+                x = _mm256_setzero_si256();
+
+            for(std::size_t p = 0; p < 10; p++)
+            {
+                __m256i const *entry = reinterpret_cast<__m256i const *>(entries[p] + half * 40);
+
+                for(std::size_t j = 0; j < 10; j++)
+                    acc[j] = _mm256_add_epi64(acc[j], _mm256_load_si256(entry + j));
+            }
+
+            std::uint64_t *out = half == 0 ? result.source.data() : result.sink.data();
+            for(std::size_t j = 0; j < 10; j++)
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j * 4), _mm256_and_si256(acc[j], mask));
+        }
+    }
+
+    __attribute__((target("avx512f"))) void sum_entries_avx512(std::uint64_t const *const (&entries)[10], hdcp_keyset &result)
+    {
+        __m512i acc[10];
+        for(auto &x : acc)
+            x = _mm512_setzero_si512();
+
+        for(std::size_t p = 0; p < 10; p++)
+        {
+            __m512i const *entry = reinterpret_cast<__m512i const *>(entries[p]);
+
+            for(std::size_t j = 0; j < 10; j++)
+                acc[j] = _mm512_add_epi64(acc[j], _mm512_load_si512(entry + j));
+        }
+
+        __m512i const mask = _mm512_set1_epi64(0xffffffffffffff);
+        for(std::size_t j = 0; j < 5; j++)
+        {
+            _mm512_storeu_si512(result.source.data() + j * 8, _mm512_and_si512(acc[j], mask));
+            _mm512_storeu_si512(result.sink.data() + j * 8, _mm512_and_si512(acc[5 + j], mask));
+        }
+    }
+#endif
+
+    sum_entries_function select_sum_entries()
+    {
+#ifdef HGK_X86_SIMD
+        if(cpu_has_avx512())
+            return sum_entries_avx512;
+
+        if(cpu_has_avx2())
+            return sum_entries_avx2;
+#endif
+
+        return sum_entries_scalar;
+    }
+} // namespace
+
+hdcp_keyset nibble_table::generate_keyset(std::bitset<40> const &ksv) const
+{
+    static sum_entries_function const sum_entries = select_sum_entries();
+
+    std::uint64_t const bits = ksv.to_ullong();
+
+    std::uint64_t const *entries[10];
+    for(std::size_t p = 0; p < 10; p++)
+        entries[p] = sums[p][(bits >> (p * 4)) & 0xf].data();
+
+    hdcp_keyset result;
+    sum_entries(entries, result);
+
+    return result;
+}
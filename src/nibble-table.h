@@ -0,0 +1,108 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file nibble-table.h
+ * @brief Defines table-driven HDCP key derivation from per-nibble partial sums.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef NIBBLE_TABLE_H
+#define NIBBLE_TABLE_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+#include "hdcp.h"
+#include "master-matrix.h"
+
+/**
+ * @brief Partial sums of the Master Key Matrix for every KSV nibble position and value.
+ * @details
+ *
+ * The 40-bit KSV is split into 10 nibbles. For each nibble position and each of the 16 nibble values
+ * the table holds the sum of the selected rows (source) and columns (sink): 80 values.
+ * A derivation is then 10 additions of 80-value vectors, with no per-bit work.
+ * The table takes 100 KiB, which fits into L2 cache. The additions use the widest vectors the running CPU supports.
+*/
+class nibble_table
+{
+public:
+    /**
+     * @brief Builds the table. The constructor is `constexpr`, so a table of a constant matrix is built at compile time.
+     * @param[in] key The packed Master Key Matrix.
+    */
+    explicit constexpr nibble_table(master_matrix const &key) : key(key), sums()
+    {
+        for(std::size_t p = 0; p < 10; p++)
+        {
+            for(std::size_t v = 0; v < 16; v++)
+            {
+                for(std::size_t b = 0; b < 4; b++)
+                {
+                    if(((v >> b) & 1) == 0)
+                        continue;
+
+                    std::uint64_t const *row    = key.row(p * 4 + b);
+                    std::uint64_t const *column = key.column(p * 4 + b);
+
+                    for(std::size_t i = 0; i < 40; i++)
+                    {
+                        sums[p][v][i] += row[i];
+                        sums[p][v][40 + i] += column[i];
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Generates the source and sink HDCP keys (HDCP versions 1.0-1.4).
+     * @param[in] ksv Key Selection Vector (KSV).
+     * @return The source and sink HDCP keys.
+     * @warning Supports not valid ksv keys.
+    */
+    hdcp_keyset generate_keyset(std::bitset<40> const &ksv) const;
+
+    /**
+     * @brief Returns the packed Master Key Matrix that the table is built from.
+    */
+    master_matrix const &matrix() const
+    {
+        return key;
+    }
+
+private:
+    master_matrix const &key;
+
+    // sums[position][value]: 40 source values followed by 40 sink values
+    alignas(64) std::array<std::array<std::array<std::uint64_t, 80>, 16>, 10> sums;
+};
+
+/**
+ * @brief The nibble table of Intel's Master Key Matrix, built at compile time.
+*/
+extern nibble_table const intel_nibble_table;
+
+#endif // NIBBLE_TABLE_H
@@ -0,0 +1,195 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file output-buffer.h
+ * @brief Defines a reusable output buffer that formatters write into.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef OUTPUT_BUFFER_H
+#define OUTPUT_BUFFER_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief A growable character buffer that formatters append to.
+ * @details
+ *
+ * The storage is kept by clear(), so a buffer that is reused for every keyset (or every block of keysets)
+ * stops allocating once it has grown to the largest output. The contents are written to a stream with write_to().
+*/
+class output_buffer
+{
+public:
+    /**
+     * @brief Constructs an empty buffer.
+    */
+    output_buffer() = default;
+
+    /**
+     * @brief Constructs an empty buffer with room for `capacity` characters.
+     * @param[in] capacity The initial capacity.
+    */
+    explicit output_buffer(std::size_t capacity)
+    {
+        reserve(capacity);
+    }
+
+    /**
+     * @brief Makes room for at least `capacity` characters.
+     * @param[in] capacity The capacity.
+    */
+    void reserve(std::size_t capacity)
+    {
+        if(capacity > storage.size())
+            storage.resize(capacity);
+    }
+
+    /**
+     * @brief Appends `n` characters and returns a pointer to them; the caller fills them in.
+     * @param[in] n Number of characters.
+     * @return A pointer to the first appended character, valid until the buffer grows again.
+    */
+    char *extend(std::size_t n)
+    {
+        if(n > storage.size() - length)
+            grow(n);
+
+        char *const result = storage.data() + length;
+        length += n;
+
+        return result;
+    }
+
+    /**
+     * @brief Appends characters.
+     * @param[in] s The characters.
+    */
+    void append(std::string_view s)
+    {
+        std::memcpy(extend(s.size()), s.data(), s.size());
+    }
+
+    /**
+     * @brief Appends one character.
+     * @param[in] c The character.
+    */
+    void append(char c)
+    {
+        *extend(1) = c;
+    }
+
+    /**
+     * @brief Removes the contents and keeps the storage.
+    */
+    void clear()
+    {
+        length = 0;
+    }
+
+    /**
+     * @brief Returns the contents.
+    */
+    char const *data() const
+    {
+        return storage.data();
+    }
+
+    /**
+     * @brief Returns the number of characters.
+    */
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    /**
+     * @brief Returns true if the buffer has no characters.
+    */
+    bool empty() const
+    {
+        return length == 0;
+    }
+
+    /**
+     * @brief Returns the last character.
+     * @pre The buffer is not empty.
+    */
+    char back() const
+    {
+        return storage[length - 1];
+    }
+
+    /**
+     * @brief Writes the first `n` characters to a stream.
+     * @param[out] os The output stream.
+     * @param[in] n Number of characters, at most size().
+    */
+    void write_to(std::ostream &os, std::size_t n) const
+    {
+        os.write(storage.data(), static_cast<std::streamsize>(n));
+    }
+
+    /**
+     * @brief Writes the contents to a stream.
+     * @param[out] os The output stream.
+    */
+    void write_to(std::ostream &os) const
+    {
+        write_to(os, length);
+    }
+
+    /**
+     * @brief Returns the contents as a string.
+    */
+    std::string str() const
+    {
+        return std::string(storage.data(), length);
+    }
+
+private:
+    /**
+     * @brief Grows the storage to hold at least `n` more characters, at least doubling it.
+     * @param[in] n Number of characters.
+    */
+    void grow(std::size_t n)
+    {
+        std::size_t capacity = storage.size() < 256 ? 256 : storage.size() * 2;
+
+        while(capacity - length < n)
+            capacity *= 2;
+
+        storage.resize(capacity);
+    }
+
+    std::vector<char> storage;
+    std::size_t length = 0;
+};
+
+#endif // OUTPUT_BUFFER_H
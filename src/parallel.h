@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/*
+ * Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ *
+ * Author: Savelii Pototskii <savelii.pototskii@gmail.com>
+ *
+ * This file is part of hdcp-gen-key.
+ *
+ * hdcp-gen-key is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * hdcp-gen-key is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with hdcp-gen-key. If not, see <https://www.gnu.org/licenses/>.
+*/
+/**
+ * @file parallel.h
+ * @brief Defines an ordered parallel pipeline: blocks are produced by worker threads and consumed in order.
+ * @author Savelii Pototskii
+ * @date 2026-10-15
+ * @copyright Copyright (C) 2025 Savelii Pototskii (savalione.com)
+ * @copyright SPDX-License-Identifier: GPL-3.0-or-later
+*/
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Returns the default number of worker threads (the number of hardware threads, at least 1).
+*/
+inline unsigned default_thread_count()
+{
+    unsigned const result = std::thread::hardware_concurrency();
+    return result == 0 ? 1 : result;
+}
+
+/**
+ * @brief Produces blocks on worker threads and consumes them on the calling thread in block order.
+ * @details
+ *
+ * Workers claim block indices in ascending order. At most `2 * threads` blocks are in flight,
+ * so memory use does not depend on the number of blocks.
+ * With one thread the blocks are produced and consumed on the calling thread.
+ *
+ * @tparam Block Block type. It is default-constructed once per slot and reused.
+ * @tparam Produce Callable type `void(std::uint64_t index, Block &block)`.
+ * @tparam Consume Callable type `bool(Block &block)`.
+ * @param[in] blocks Number of blocks.
+ * @param[in] threads Number of worker threads.
+ * @param[in] produce Fills a block. Called concurrently for different blocks.
+ * @param[in] consume Consumes a block. Returns false to stop the pipeline.
+*/
+template<typename Block, typename Produce, typename Consume>
+void run_ordered(std::uint64_t blocks, unsigned threads, Produce produce, Consume consume)
+{
+    if(threads <= 1)
+    {
+        Block block;
+
+        for(std::uint64_t b = 0; b < blocks; b++)
+        {
+            produce(b, block);
+
+            if(!consume(block))
+                break;
+        }
+
+        return;
+    }
+
+    constexpr std::uint64_t empty = std::numeric_limits<std::uint64_t>::max();
+    std::size_t const window      = static_cast<std::size_t>(threads) * 2;
+
+    std::vector<Block> slots(window);
+    std::vector<std::uint64_t> ready(window, empty); // Index of the block that is ready in a slot
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::uint64_t next_block = 0;
+    std::uint64_t consumed   = 0;
+    bool stop                = false;
+
+    auto const worker = [&]()
+    {
+        std::unique_lock<std::mutex> lock(m);
+
+        while(!stop && next_block < blocks)
+        {
+            std::uint64_t const b = next_block++;
+
+            // Wait until the slot of the block is consumed
+            cv.wait(lock, [&]() { return stop || b < consumed + window; });
+            if(stop)
+                break;
+
+            lock.unlock();
+            produce(b, slots[b % window]);
+            lock.lock();
+
+            ready[b % window] = b;
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for(unsigned t = 0; t < threads; t++)
+        workers.emplace_back(worker);
+
+    for(std::uint64_t b = 0; b < blocks; b++)
+    {
+        std::size_t const slot = b % window;
+
+        {
+            std::unique_lock<std::mutex> lock(m);
+            cv.wait(lock, [&]() { return ready[slot] == b; });
+        }
+
+        bool const proceed = consume(slots[slot]);
+
+        std::lock_guard<std::mutex> lock(m);
+        ready[slot] = empty;
+        consumed++;
+        stop = !proceed;
+        cv.notify_all();
+
+        if(stop)
+            break;
+    }
+
+    for(auto &x : workers)
+        x.join();
+}
+
+#endif // PARALLEL_H